@@ -0,0 +1,480 @@
+/*=======================================================================================*
+ * @file    CRC_Bench.c
+ * @author  Damian Pala
+ * @date    18-10-2026
+ * @brief   This file contains throughput benchmark of CRC module.
+ *
+ *          Every CRC kernel available in the build is measured for buffer sizes from 1 B
+ *          to 64 MiB and several buffer alignments. Before measurement result of the kernel
+ *          is compared with CRC_CtxUpdate, benchmark fails on mismatch. Results are written
+ *          to stdout as CSV:
+ *
+ *            width,implementation,method,size,alignment,iterations,gbps,cycles_per_byte
+ *
+ *          Cycles are read from time stamp counter where available (reference cycles,
+ *          not core cycles), otherwise cycles_per_byte is 0. Method of dispatch rows is the
+ *          kernel resolved for the CPU and buffer size, e.g. sse42 or clmul. Calculation method
+ *          is fixed at compile time, so bitwise and nibble kernels are measured by separate
+ *          builds, and -DCPUF_FEATURES_MASK=0 keeps dispatch rows on portable code:
+ *
+ *            gcc -std=c11 -O2 -o crc_bench bench/CRC_Bench.c src/CPUF.c
+ *            gcc -std=c11 -O2 -DCRC_CALC_METHOD=CRC_CALC_METHOD_BITWISE -o crc_bench_bitwise bench/CRC_Bench.c src/CPUF.c
+ *            gcc -std=c11 -O2 -DCRC_CALC_METHOD=CRC_CALC_METHOD_NIBBLE -o crc_bench_nibble bench/CRC_Bench.c src/CPUF.c
+ *            gcc -std=c11 -O2 -DCPUF_FEATURES_MASK=0 -o crc_bench_portable bench/CRC_Bench.c src/CPUF.c
+ *
+ *          Usage: crc_bench [--width 8|16|32|32C] [--max-size bytes] [--bytes bytes_per_measurement]
+ *======================================================================================*/
+
+/**
+ * @addtogroup CRC_Bench CRC throughput benchmark
+ * @{
+ * @brief Benchmark implementation.
+ */
+
+/*======================================================================================*/
+/*                       ####### PREPROCESSOR DIRECTIVES #######                        */
+/*======================================================================================*/
+/*---------------------- INCLUDE DIRECTIVES FOR STANDARD HEADERS -----------------------*/
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/*----------------------- INCLUDE DIRECTIVES FOR OTHER HEADERS -------------------------*/
+/* Module is included to reach its internal kernels */
+#include "../src/CRC.c"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <x86intrin.h>
+#define BENCH_TSC_ENABLED
+#endif
+
+/*----------------------------- LOCAL OBJECT-LIKE MACROS -------------------------------*/
+#define BENCH_MAX_SIZE                (64 * 1024 * 1024)
+#define BENCH_BYTES_PER_MEASUREMENT   (16 * 1024 * 1024)
+#define BENCH_REPEATS                 3
+#define BENCH_BUFFER_ALIGNMENT        64
+
+#if CRC_CALC_METHOD == CRC_CALC_METHOD_TABLE
+#define BENCH_METHOD_NAME             "table"
+#elif CRC_CALC_METHOD == CRC_CALC_METHOD_NIBBLE
+#define BENCH_METHOD_NAME             "nibble"
+#else
+#define BENCH_METHOD_NAME             "bitwise"
+#endif
+
+/*---------------------------- LOCAL FUNCTION-LIKE MACROS ------------------------------*/
+#define ARRAY_SIZE(array)             (sizeof(array) / sizeof((array)[0]))
+
+/*======================================================================================*/
+/*                      ####### LOCAL TYPE DECLARATIONS #######                         */
+/*======================================================================================*/
+/*-------------------------------- OTHER TYPEDEFS --------------------------------------*/
+typedef uint32_t (*Kernel_T)(uint32_t remainder, uint8_t const *data, size_t nBytes);
+
+/*------------------------------------- ENUMS ------------------------------------------*/
+
+/*------------------------------- STRUCT AND UNIONS ------------------------------------*/
+typedef struct Variant_Tag
+{
+  char const *width;            ///< CRC width name
+  CRC_CalcSize_T crcSize;       ///< CRC size, kernel result is checked by CRC context of this size
+  char const *name;             ///< Implementation name
+  Kernel_T kernel;              ///< Function updating remainder with data
+  bool (*isSupported)(void);    ///< Checks if CPU supports the kernel, NULL if always supported
+  char const *(*getMethod)(size_t nBytes);  ///< Returns name of kernel used for the size, NULL if #BENCH_METHOD_NAME
+} Variant_T;
+
+/*======================================================================================*/
+/*                         ####### OBJECT DEFINITIONS #######                           */
+/*======================================================================================*/
+/*--------------------------------- EXPORTED OBJECTS -----------------------------------*/
+
+/*---------------------------------- LOCAL OBJECTS -------------------------------------*/
+static const size_t Alignments[] = {0, 1, 3, 8};
+
+static volatile uint32_t Sink;
+
+/*======================================================================================*/
+/*                    ####### LOCAL FUNCTIONS PROTOTYPES #######                        */
+/*======================================================================================*/
+static uint32_t Crc8Dispatch(uint32_t remainder, uint8_t const *data, size_t nBytes);
+static uint32_t Crc16Dispatch(uint32_t remainder, uint8_t const *data, size_t nBytes);
+static uint32_t Crc32Dispatch(uint32_t remainder, uint8_t const *data, size_t nBytes);
+static uint32_t Crc32cDispatch(uint32_t remainder, uint8_t const *data, size_t nBytes);
+static char const * GetFoldMethod(size_t nBytes);
+static char const * GetCrc32cMethod(size_t nBytes);
+#if CRC_CALC_METHOD == CRC_CALC_METHOD_TABLE
+static uint32_t Crc16ByteTable(uint32_t remainder, uint8_t const *data, size_t nBytes);
+static uint32_t Crc32ByteTable(uint32_t remainder, uint8_t const *data, size_t nBytes);
+static uint32_t Crc32cByteTable(uint32_t remainder, uint8_t const *data, size_t nBytes);
+#endif
+#ifdef CRC32_SLICING_ENABLED
+static uint32_t Crc32Slicing8(uint32_t remainder, uint8_t const *data, size_t nBytes);
+#if CRC32_SLICING == 16
+static uint32_t Crc32Slicing16(uint32_t remainder, uint8_t const *data, size_t nBytes);
+#endif
+#endif
+#ifdef CRC_CLMUL_ENABLED
+static bool IsClmulAvailable(void);
+static uint32_t Crc16Clmul(uint32_t remainder, uint8_t const *data, size_t nBytes);
+static uint32_t Crc32Clmul(uint32_t remainder, uint8_t const *data, size_t nBytes);
+#endif
+#ifdef CRC_SSE42_ENABLED
+static bool IsSse42Available(void);
+static uint32_t Crc32cSse42(uint32_t remainder, uint8_t const *data, size_t nBytes);
+static char const * GetSse42Method(size_t nBytes);
+#endif
+static double GetTime(void);
+static uint64_t GetCycles(void);
+static bool RunVariant(Variant_T const *variant, uint8_t const *buffer, size_t maxSize, size_t bytesPerMeasurement);
+
+/*======================================================================================*/
+/*                  ####### EXPORTED FUNCTIONS DEFINITIONS #######                      */
+/*======================================================================================*/
+int main(int argc, char *argv[])
+{
+  static const Variant_T variants[] =
+  {
+    {"8",   CRC_CALC_SIZE_8,   "dispatch",   Crc8Dispatch,    NULL,             NULL},
+    {"16",  CRC_CALC_SIZE_16,  "dispatch",   Crc16Dispatch,   NULL,             GetFoldMethod},
+#if CRC_CALC_METHOD == CRC_CALC_METHOD_TABLE
+    {"16",  CRC_CALC_SIZE_16,  "table",      Crc16ByteTable,  NULL,             NULL},
+#endif
+#ifdef CRC_CLMUL_ENABLED
+    {"16",  CRC_CALC_SIZE_16,  "clmul",      Crc16Clmul,      IsClmulAvailable, NULL},
+#endif
+    {"32",  CRC_CALC_SIZE_32,  "dispatch",   Crc32Dispatch,   NULL,             GetFoldMethod},
+#if CRC_CALC_METHOD == CRC_CALC_METHOD_TABLE
+    {"32",  CRC_CALC_SIZE_32,  "table",      Crc32ByteTable,  NULL,             NULL},
+#endif
+#ifdef CRC32_SLICING_ENABLED
+    {"32",  CRC_CALC_SIZE_32,  "slicing8",   Crc32Slicing8,   NULL,             NULL},
+#if CRC32_SLICING == 16
+    {"32",  CRC_CALC_SIZE_32,  "slicing16",  Crc32Slicing16,  NULL,             NULL},
+#endif
+#endif
+#ifdef CRC_CLMUL_ENABLED
+    {"32",  CRC_CALC_SIZE_32,  "clmul",      Crc32Clmul,      IsClmulAvailable, NULL},
+#endif
+    {"32C", CRC_CALC_SIZE_32C, "dispatch",   Crc32cDispatch,  NULL,             GetCrc32cMethod},
+#if CRC_CALC_METHOD == CRC_CALC_METHOD_TABLE
+    {"32C", CRC_CALC_SIZE_32C, "table",      Crc32cByteTable, NULL,             NULL},
+#endif
+#ifdef CRC_SSE42_ENABLED
+    {"32C", CRC_CALC_SIZE_32C, "sse42",      Crc32cSse42,     IsSse42Available, GetSse42Method},
+#endif
+  };
+  char const *width = NULL;
+  size_t maxSize = BENCH_MAX_SIZE;
+  size_t bytesPerMeasurement = BENCH_BYTES_PER_MEASUREMENT;
+  uint8_t *buffer;
+  int result = EXIT_SUCCESS;
+
+  for (int arg = 1; arg < argc; arg++)
+  {
+    if ( (0 == strcmp(argv[arg], "--width")) && (arg + 1 < argc) )
+    {
+      width = argv[++arg];
+    }
+    else if ( (0 == strcmp(argv[arg], "--max-size")) && (arg + 1 < argc) )
+    {
+      maxSize = strtoull(argv[++arg], NULL, 0);
+    }
+    else if ( (0 == strcmp(argv[arg], "--bytes")) && (arg + 1 < argc) )
+    {
+      bytesPerMeasurement = strtoull(argv[++arg], NULL, 0);
+    }
+    else
+    {
+      fprintf(stderr, "Usage: %s [--width 8|16|32|32C] [--max-size bytes] [--bytes bytes_per_measurement]\n", argv[0]);
+      return EXIT_FAILURE;
+    }
+  }
+
+  buffer = aligned_alloc(BENCH_BUFFER_ALIGNMENT, maxSize + 2 * BENCH_BUFFER_ALIGNMENT);
+  if (NULL == buffer)
+  {
+    fprintf(stderr, "Cannot allocate %zu bytes\n", maxSize);
+    return EXIT_FAILURE;
+  }
+
+  for (size_t byte = 0; byte < maxSize + 2 * BENCH_BUFFER_ALIGNMENT; byte++)
+  {
+    buffer[byte] = (uint8_t)(byte * 131 + (byte >> 8));
+  }
+
+  printf("width,implementation,method,size,alignment,iterations,gbps,cycles_per_byte\n");
+
+  for (size_t idx = 0; idx < ARRAY_SIZE(variants); idx++)
+  {
+    if ( ((NULL != width) && (0 != strcmp(width, variants[idx].width)))
+        || ((NULL != variants[idx].isSupported) && (false == variants[idx].isSupported())) )
+    {
+      continue;
+    }
+
+    if (false == RunVariant(&variants[idx], buffer, maxSize, bytesPerMeasurement))
+    {
+      result = EXIT_FAILURE;
+      break;
+    }
+  }
+
+  free(buffer);
+
+  return result;
+}
+
+/*======================================================================================*/
+/*                   ####### LOCAL FUNCTIONS DEFINITIONS #######                        */
+/*======================================================================================*/
+static uint32_t Crc8Dispatch(uint32_t remainder, uint8_t const *data, size_t nBytes)
+{
+  return UpdateCrc8((uint8_t)remainder, data, nBytes);
+}
+
+static uint32_t Crc16Dispatch(uint32_t remainder, uint8_t const *data, size_t nBytes)
+{
+  return UpdateCrc16((uint16_t)remainder, data, nBytes);
+}
+
+static uint32_t Crc32Dispatch(uint32_t remainder, uint8_t const *data, size_t nBytes)
+{
+  return UpdateCrc32(remainder, data, nBytes);
+}
+
+static uint32_t Crc32cDispatch(uint32_t remainder, uint8_t const *data, size_t nBytes)
+{
+  return UpdateCrc32c(remainder, data, nBytes);
+}
+
+/* UpdateCrc16 and UpdateCrc32 fold long buffers by carry-less multiplication when the CPU supports it */
+static char const * GetFoldMethod(size_t nBytes)
+{
+#ifdef CRC_CLMUL_ENABLED
+  if ( (nBytes >= CRC_CLMUL_THRESHOLD) && (NULL != Kernels.foldClmul) )
+  {
+    return "clmul";
+  }
+#else
+  (void)nBytes;
+#endif
+
+  return BENCH_METHOD_NAME;
+}
+
+static char const * GetCrc32cMethod(size_t nBytes)
+{
+  (void)nBytes;
+
+#ifdef CRC_SSE42_ENABLED
+  if (UpdateCrc32cSse42Clmul == Kernels.updateCrc32c)
+  {
+    return "sse42_clmul";
+  }
+  else if (UpdateCrc32cSse42 == Kernels.updateCrc32c)
+  {
+    return "sse42";
+  }
+#endif
+
+  return BENCH_METHOD_NAME;
+}
+
+#if CRC_CALC_METHOD == CRC_CALC_METHOD_TABLE
+static uint32_t Crc16ByteTable(uint32_t remainder, uint8_t const *data, size_t nBytes)
+{
+  uint16_t crc = (uint16_t)remainder;
+
+  for (size_t byte = 0; byte < nBytes; byte++)
+  {
+    crc = (crc << 8) ^ Crc16Table[(crc >> 8) ^ data[byte]];
+  }
+
+  return crc;
+}
+
+static uint32_t Crc32ByteTable(uint32_t remainder, uint8_t const *data, size_t nBytes)
+{
+  for (size_t byte = 0; byte < nBytes; byte++)
+  {
+    remainder = (remainder << 8) ^ Crc32Table[(remainder >> 24) ^ data[byte]];
+  }
+
+  return remainder;
+}
+
+static uint32_t Crc32cByteTable(uint32_t remainder, uint8_t const *data, size_t nBytes)
+{
+  for (size_t byte = 0; byte < nBytes; byte++)
+  {
+    remainder = (remainder >> 8) ^ Crc32cTable[(remainder ^ data[byte]) & 0xFF];
+  }
+
+  return remainder;
+}
+#endif
+
+#ifdef CRC32_SLICING_ENABLED
+static uint32_t Crc32Slicing8(uint32_t remainder, uint8_t const *data, size_t nBytes)
+{
+  remainder = UpdateCrc32Slicing8(remainder, data, nBytes / 8);
+
+  return Crc32ByteTable(remainder, &data[nBytes & ~(size_t)7], nBytes & 7);
+}
+
+#if CRC32_SLICING == 16
+static uint32_t Crc32Slicing16(uint32_t remainder, uint8_t const *data, size_t nBytes)
+{
+  remainder = UpdateCrc32Slicing16(remainder, data, nBytes / 16);
+
+  return Crc32ByteTable(remainder, &data[nBytes & ~(size_t)15], nBytes & 15);
+}
+#endif
+#endif
+
+#ifdef CRC_CLMUL_ENABLED
+static bool IsClmulAvailable(void)
+{
+  return CPUF_IsSupported(CPUF_FEATURE_PCLMUL | CPUF_FEATURE_SSSE3);
+}
+
+static uint32_t Crc16Clmul(uint32_t remainder, uint8_t const *data, size_t nBytes)
+{
+  if (nBytes >= 64)
+  {
+    uint8_t folded[16];
+    size_t nFoldedBytes = FoldClmul(folded, remainder << 16, data, nBytes, &Crc16ClmulConstants);
+
+    remainder = Crc16ByteTable(0, folded, sizeof(folded));
+    data += nFoldedBytes;
+    nBytes -= nFoldedBytes;
+  }
+
+  return Crc16ByteTable(remainder, data, nBytes);
+}
+
+static uint32_t Crc32Clmul(uint32_t remainder, uint8_t const *data, size_t nBytes)
+{
+  if (nBytes >= 64)
+  {
+    uint8_t folded[16];
+    size_t nFoldedBytes = FoldClmul(folded, remainder, data, nBytes, &Crc32ClmulConstants);
+
+    remainder = Crc32ByteTable(0, folded, sizeof(folded));
+    data += nFoldedBytes;
+    nBytes -= nFoldedBytes;
+  }
+
+  return Crc32ByteTable(remainder, data, nBytes);
+}
+#endif
+
+#ifdef CRC_SSE42_ENABLED
+static bool IsSse42Available(void)
+{
+  return CPUF_IsSupported(CPUF_FEATURE_SSE42);
+}
+
+static uint32_t Crc32cSse42(uint32_t remainder, uint8_t const *data, size_t nBytes)
+{
+  return UpdateCrc32cSse42(remainder, data, nBytes);
+}
+
+static char const * GetSse42Method(size_t nBytes)
+{
+  (void)nBytes;
+
+  return "sse42";
+}
+#endif
+
+static double GetTime(void)
+{
+  struct timespec now;
+
+  clock_gettime(CLOCK_MONOTONIC, &now);
+
+  return ((double)now.tv_sec + (double)now.tv_nsec * 1e-9);
+}
+
+static uint64_t GetCycles(void)
+{
+#ifdef BENCH_TSC_ENABLED
+  return __rdtsc();
+#else
+  return 0;
+#endif
+}
+
+/**
+ * @brief   Measures kernel for every buffer size and alignment, the best of #BENCH_REPEATS runs is reported.
+ * @param   [in] variant              is measured kernel
+ * @param   [in] buffer               is data buffer, aligned to #BENCH_BUFFER_ALIGNMENT
+ * @param   [in] maxSize              is the largest measured size in bytes
+ * @param   [in] bytesPerMeasurement  is number of bytes processed in a single run
+ * @return  false if kernel result differs from CRC_CtxUpdate, measurement is stopped then.
+ */
+static bool RunVariant(Variant_T const *variant, uint8_t const *buffer, size_t maxSize, size_t bytesPerMeasurement)
+{
+  for (size_t size = 1; size <= maxSize; size *= 2)
+  {
+    for (size_t alignIdx = 0; alignIdx < ARRAY_SIZE(Alignments); alignIdx++)
+    {
+      uint8_t const *data = &buffer[Alignments[alignIdx]];
+      size_t iterations = (size < bytesPerMeasurement) ? (bytesPerMeasurement / size) : 1;
+      double bestTime = 0;
+      uint64_t bestCycles = 0;
+      uint32_t result = variant->kernel(0xFFFFFFFF, data, size);
+      CRC_Ctx_T ctx;
+
+      ctx.crcSize = variant->crcSize;
+      ctx.remainder = 0xFFFFFFFF;
+      CRC_CtxUpdate(&ctx, data, size);
+
+      if (result != ctx.remainder)
+      {
+        fprintf(stderr, "%s,%s: remainder 0x%08X differs from 0x%08X of CRC_CtxUpdate, size %zu, alignment %zu\n",
+                variant->width, variant->name, (unsigned int)result, (unsigned int)ctx.remainder, size,
+                Alignments[alignIdx]);
+        return false;
+      }
+
+      for (uint8_t repeat = 0; repeat < BENCH_REPEATS; repeat++)
+      {
+        double startTime = GetTime();
+        uint64_t startCycles = GetCycles();
+        double time;
+
+        for (size_t iteration = 0; iteration < iterations; iteration++)
+        {
+          result ^= variant->kernel(0xFFFFFFFF, data, size);
+        }
+
+        time = GetTime() - startTime;
+
+        if ( (0 == repeat) || (time < bestTime) )
+        {
+          bestTime = time;
+          bestCycles = GetCycles() - startCycles;
+        }
+      }
+
+      Sink = result;
+
+      printf("%s,%s,%s,%zu,%zu,%zu,%.3f,%.3f\n", variant->width, variant->name,
+             (NULL != variant->getMethod) ? variant->getMethod(size) : BENCH_METHOD_NAME, size,
+             Alignments[alignIdx], iterations, (double)(size * iterations) / bestTime * 1e-9,
+             (double)bestCycles / (double)(size * iterations));
+    }
+  }
+
+  return true;
+}
+
+/**
+ * @}
+ */
@@ -0,0 +1,164 @@
+/*=======================================================================================*
+ * @file    CPUF.c
+ * @author  Damian Pala
+ * @date    18-10-2026
+ * @brief   This file contains all implementations for CPUF module.
+ *======================================================================================*/
+
+/**
+ * @addtogroup CPUF Description
+ * @{
+ * @brief Module for runtime detection of CPU features.
+ */
+
+/*======================================================================================*/
+/*                       ####### PREPROCESSOR DIRECTIVES #######                        */
+/*======================================================================================*/
+/*-------------------------------- INCLUDE DIRECTIVES ----------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "CPUF.h"
+
+#ifdef CPUF_DETECTION_ENABLED
+#include <cpuid.h>
+#endif
+
+/*----------------------------- LOCAL OBJECT-LIKE MACROS -------------------------------*/
+#define CPUF_DETECTED                 (1U << 31)  ///< Set in cached features after detection
+
+/* cpuid leaf 1 */
+#define CPUID1_EDX_SSE2               (1U << 26)
+#define CPUID1_ECX_PCLMUL             (1U << 1)
+#define CPUID1_ECX_SSSE3              (1U << 9)
+#define CPUID1_ECX_SSE41              (1U << 19)
+#define CPUID1_ECX_SSE42              (1U << 20)
+#define CPUID1_ECX_OSXSAVE            (1U << 27)
+#define CPUID1_ECX_AVX                (1U << 28)
+/* cpuid leaf 7, subleaf 0 */
+#define CPUID7_EBX_AVX2               (1U << 5)
+#define CPUID7_EBX_BMI2               (1U << 8)
+#define CPUID7_EBX_AVX512F            (1U << 16)
+#define CPUID7_EBX_AVX512BW           (1U << 30)
+#define CPUID7_ECX_VPCLMULQDQ         (1U << 10)
+/* XCR0 register, state components enabled by OS */
+#define XCR0_AVX_STATE                0x06  ///< XMM and YMM registers
+#define XCR0_AVX512_STATE             0xE6  ///< XMM, YMM, opmask and ZMM registers
+
+/*---------------------------- LOCAL FUNCTION-LIKE MACROS ------------------------------*/
+
+/*======================================================================================*/
+/*                      ####### LOCAL TYPE DECLARATIONS #######                         */
+/*======================================================================================*/
+/*-------------------------------- OTHER TYPEDEFS --------------------------------------*/
+
+/*------------------------------------- ENUMS ------------------------------------------*/
+
+/*------------------------------- STRUCT AND UNIONS ------------------------------------*/
+
+/*======================================================================================*/
+/*                         ####### OBJECT DEFINITIONS #######                           */
+/*======================================================================================*/
+/*--------------------------------- EXPORTED OBJECTS -----------------------------------*/
+
+/*---------------------------------- LOCAL OBJECTS -------------------------------------*/
+/** Detected features, written once at startup by resolvers, before any thread is started */
+static uint32_t Features = 0;
+
+/*======================================================================================*/
+/*                    ####### LOCAL FUNCTIONS PROTOTYPES #######                        */
+/*======================================================================================*/
+static uint32_t DetectFeatures(void);
+#ifdef CPUF_DETECTION_ENABLED
+static uint64_t ReadXcr0(void);
+#endif
+
+/*======================================================================================*/
+/*                  ####### EXPORTED FUNCTIONS DEFINITIONS #######                      */
+/*======================================================================================*/
+uint32_t CPUF_GetFeatures(void)
+{
+  uint32_t features = Features;
+
+  if (0 == (features & CPUF_DETECTED))
+  {
+    features = (DetectFeatures() & CPUF_FEATURES_MASK) | CPUF_DETECTED;
+    Features = features;
+  }
+
+  return (features & ~CPUF_DETECTED);
+}
+
+bool CPUF_IsSupported(uint32_t features)
+{
+  return (features == (CPUF_GetFeatures() & features));
+}
+
+/*======================================================================================*/
+/*                   ####### LOCAL FUNCTIONS DEFINITIONS #######                        */
+/*======================================================================================*/
+static uint32_t DetectFeatures(void)
+{
+  uint32_t features = 0;
+
+#ifdef CPUF_DETECTION_ENABLED
+  unsigned int eax, ebx, ecx, edx;
+  uint64_t xcr0 = 0;
+
+  if (0 == __get_cpuid(1, &eax, &ebx, &ecx, &edx))
+  {
+    return 0;
+  }
+
+  features |= (edx & CPUID1_EDX_SSE2) ? CPUF_FEATURE_SSE2 : 0;
+  features |= (ecx & CPUID1_ECX_SSSE3) ? CPUF_FEATURE_SSSE3 : 0;
+  features |= (ecx & CPUID1_ECX_SSE41) ? CPUF_FEATURE_SSE41 : 0;
+  features |= (ecx & CPUID1_ECX_SSE42) ? CPUF_FEATURE_SSE42 : 0;
+  features |= (ecx & CPUID1_ECX_PCLMUL) ? CPUF_FEATURE_PCLMUL : 0;
+
+  /* AVX registers are usable only if OS saves them on context switch */
+  if (0 != (ecx & CPUID1_ECX_OSXSAVE))
+  {
+    xcr0 = ReadXcr0();
+  }
+
+  if ( (0 != (ecx & CPUID1_ECX_AVX)) && (XCR0_AVX_STATE == (xcr0 & XCR0_AVX_STATE)) )
+  {
+    features |= CPUF_FEATURE_AVX;
+  }
+
+  if (0 != __get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx))
+  {
+    features |= (ebx & CPUID7_EBX_BMI2) ? CPUF_FEATURE_BMI2 : 0;
+
+    if (0 != (features & CPUF_FEATURE_AVX))
+    {
+      features |= (ebx & CPUID7_EBX_AVX2) ? CPUF_FEATURE_AVX2 : 0;
+      features |= (ecx & CPUID7_ECX_VPCLMULQDQ) ? CPUF_FEATURE_VPCLMULQDQ : 0;
+
+      if (XCR0_AVX512_STATE == (xcr0 & XCR0_AVX512_STATE))
+      {
+        features |= (ebx & CPUID7_EBX_AVX512F) ? CPUF_FEATURE_AVX512F : 0;
+        features |= (ebx & CPUID7_EBX_AVX512BW) ? CPUF_FEATURE_AVX512BW : 0;
+      }
+    }
+  }
+#endif
+
+  return features;
+}
+
+#ifdef CPUF_DETECTION_ENABLED
+static uint64_t ReadXcr0(void)
+{
+  uint32_t low, high;
+
+  __asm__ volatile ("xgetbv" : "=a" (low), "=d" (high) : "c" (0));
+
+  return (((uint64_t)high << 32) | low);
+}
+#endif
+
+/**
+ * @}
+ */
@@ -0,0 +1,111 @@
+/*=======================================================================================*
+ * @file    CPUF.h
+ * @author  Damian Pala
+ * @date    18-10-2026
+ * @brief   Header file for CPUF module
+ *
+ *          This file contains API of CPUF module
+ *======================================================================================*/
+/*----------------------- DEFINE TO PREVENT RECURSIVE INCLUSION ------------------------*/
+#ifndef CPUF_H_
+#define CPUF_H_
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/**
+ * @addtogroup CPUF Description
+ * @{
+ * @brief Module for runtime detection of CPU features.
+ *
+ *        Features are detected once with cpuid, including OS support of AVX and AVX-512 registers.
+ *        Modules with vectorized kernels keep dispatch tables of function pointers, which are
+ *        resolved by functions marked with #CPUF_RESOLVER before main is called. Until then, and on
+ *        targets without detection, the tables point to portable implementations.
+ */
+
+/*======================================================================================*/
+/*                       ####### PREPROCESSOR DIRECTIVES #######                        */
+/*======================================================================================*/
+/*-------------------------------- INCLUDE DIRECTIVES ----------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+
+/*----------------------------- LOCAL OBJECT-LIKE MACROS -------------------------------*/
+/**
+ * Mask of features which may be reported as supported, e.g. -DCPUF_FEATURES_MASK=0 builds
+ * binary using only portable kernels, what is used to test fallbacks on modern machines.
+ */
+#ifndef CPUF_FEATURES_MASK
+#define CPUF_FEATURES_MASK            0xFFFFFFFF
+#endif
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define CPUF_DETECTION_ENABLED
+/** Marks function resolving dispatch table, it is called once at startup */
+#define CPUF_RESOLVER                 __attribute__((constructor))
+#endif
+
+/*---------------------------- LOCAL FUNCTION-LIKE MACROS ------------------------------*/
+
+/*======================================================================================*/
+/*                     ####### EXPORTED TYPE DECLARATIONS #######                       */
+/*======================================================================================*/
+/*-------------------------------- OTHER TYPEDEFS --------------------------------------*/
+
+/*------------------------------------- ENUMS ------------------------------------------*/
+/** CPU features, bit flags */
+typedef enum CPUF_Feature_Tag
+{
+  CPUF_FEATURE_SSE2             = (1 << 0),
+  CPUF_FEATURE_SSSE3            = (1 << 1),
+  CPUF_FEATURE_SSE41            = (1 << 2),
+  CPUF_FEATURE_SSE42            = (1 << 3),   ///< Includes crc32 instruction
+  CPUF_FEATURE_PCLMUL           = (1 << 4),
+  CPUF_FEATURE_AVX              = (1 << 5),
+  CPUF_FEATURE_AVX2             = (1 << 6),
+  CPUF_FEATURE_BMI2             = (1 << 7),
+  CPUF_FEATURE_AVX512F          = (1 << 8),
+  CPUF_FEATURE_AVX512BW         = (1 << 9),
+  CPUF_FEATURE_VPCLMULQDQ       = (1 << 10),  ///< Carry-less multiplication of AVX2 and AVX-512 vectors
+} CPUF_Feature_T;
+
+/*------------------------------- STRUCT AND UNIONS ------------------------------------*/
+
+/*======================================================================================*/
+/*                    ####### EXPORTED OBJECT DECLARATIONS #######                      */
+/*======================================================================================*/
+
+/*======================================================================================*/
+/*                   ####### EXPORTED FUNCTIONS PROTOTYPES #######                      */
+/*======================================================================================*/
+/**
+ * @brief   This function returns features supported by CPU and OS, they are detected at the first call.
+ * @return  Bit flags of #CPUF_Feature_T.
+ */
+uint32_t CPUF_GetFeatures(void);
+
+
+/**
+ * @brief   This function checks if all given features are supported.
+ * @param   [in] features   is bit flags of #CPUF_Feature_T
+ * @return  Result of the check.
+ * @retval  true if all features are supported
+ * @retval  false otherwise
+ */
+bool CPUF_IsSupported(uint32_t features);
+
+/*======================================================================================*/
+/*                          ####### INLINE FUNCTIONS #######                            */
+/*======================================================================================*/
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CPUF_H_ */
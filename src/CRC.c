@@ -16,31 +16,87 @@
 /*======================================================================================*/
 /*-------------------------------- INCLUDE DIRECTIVES ----------------------------------*/
 #include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
 
 #include "CRC.h"
+#include "CPUF.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+
+#if CRC_CALC_METHOD == CRC_CALC_METHOD_TABLE
+#define CRC_CLMUL_ENABLED
+#endif
+#if defined(__x86_64__)
+#define CRC_SSE42_ENABLED
+#endif
+#endif
 
 /*----------------------------- LOCAL OBJECT-LIKE MACROS -------------------------------*/
 #define CRC8_INITIAL_VALUE            0xF1
 #define CRC16_INITIAL_VALUE           0xF1F1
 #define CRC32_INITIAL_VALUE           0xF1F1F1F1
+#define CRC32C_INITIAL_VALUE          0xFFFFFFFF
 
 #define CRC8_FINAL_XOR_VALUE          0xAB
 #define CRC16_FINAL_XOR_VALUE         0xABAB
 #define CRC32_FINAL_XOR_VALUE         0xABABABAB
+#define CRC32C_FINAL_XOR_VALUE        0xFFFFFFFF
 
 #define CRC8_POLYNOMIAL               0xE0
 #define CRC16_POLYNOMIAL              0x8408
 #define CRC32_POLYNOMIAL              0xEDB88320
+#define CRC32C_POLYNOMIAL             0x82F63B78    ///< Reflected, CRC-32C is calculated LSB first
+#define CRC32C_POLYNOMIAL_MSB_FIRST   0x1EDC6F41    ///< CRC-32C polynomial for MSB first algorithm
 
 #define CRC8_MSBIT                    (1 << 7)
 #define CRC16_MSBIT                   (1 << 15)
 #define CRC32_MSBIT                   (1 << 31)
 
+#if CRC32_SLICING != 0 && CRC32_SLICING != 8 && CRC32_SLICING != 16
+#error CRC32_SLICING must be 0, 8 or 16!
+#endif
+
+#if (CRC_CALC_METHOD == CRC_CALC_METHOD_TABLE) && (CRC32_SLICING > 0)
+#define CRC32_SLICING_ENABLED
+#endif
+
+#define CRC32_SLICING_8_THRESHOLD     32    ///< Minimal buffer length in bytes processed by slicing-by-8
+#define CRC32_SLICING_16_THRESHOLD    256   ///< Minimal buffer length in bytes processed by slicing-by-16
+#define CRC_CLMUL_THRESHOLD           128   ///< Minimal buffer length in bytes processed by carry-less multiply folding
+
+#define CRC_COPY_BLOCK_SIZE           4096  ///< Block length in bytes of fused copy and CRC calculation, fits in L1 cache
+
+#define CRC_COPY_STREAMING_THRESHOLD  (1024 * 1024)  ///< Minimal length in bytes copied with non-temporal stores
+
+#define CRC_PATCH_BLOCK_SIZE          64    ///< Length in bytes of difference block of CRC patching
+
+#define CRC_BATCH_LANES               4     ///< Number of buffers processed at once by interleaved lookups
+
+#if defined(__GNUC__) && !defined(__clang__) && (__GNUC__ >= 8)
+#define CRC_UNROLL_LANES              _Pragma("GCC unroll 4")
+#else
+#define CRC_UNROLL_LANES
+#endif
+
+#define CRC32C_SHORT_BLOCK            256   ///< Stream length in bytes of CRC-32C three streams algorithm, short variant
+#define CRC32C_LONG_BLOCK             2048  ///< Stream length in bytes of CRC-32C three streams algorithm, long variant
+/* x^(8 * n - 33) mod P, shifts CRC-32C by n zero bytes with carry-less multiplication and crc32 instruction */
+#define CRC32C_SHIFT_SHORT_BLOCK      0xB9E02B86
+#define CRC32C_SHIFT_2_SHORT_BLOCKS   0xDD7E3B0C
+#define CRC32C_SHIFT_LONG_BLOCK       0xA51B6135
+#define CRC32C_SHIFT_2_LONG_BLOCKS    0x82F89C77
+
 /*---------------------------- LOCAL FUNCTION-LIKE MACROS ------------------------------*/
 #define CRC8_BYTE_TO_REMAINDER(byte)  (byte)
 #define CRC16_BYTE_TO_REMAINDER(byte) (byte << 8)
 #define CRC32_BYTE_TO_REMAINDER(byte) (byte << 24)
 
+#define LOAD_UINT32_BE(bytes)         (((uint32_t)(bytes)[0] << 24) | ((uint32_t)(bytes)[1] << 16) | \
+                                       ((uint32_t)(bytes)[2] << 8) | (uint32_t)(bytes)[3])
+
 /*======================================================================================*/
 /*                      ####### LOCAL TYPE DECLARATIONS #######                         */
 /*======================================================================================*/
@@ -49,6 +105,28 @@
 /*------------------------------------- ENUMS ------------------------------------------*/
 
 /*------------------------------- STRUCT AND UNIONS ------------------------------------*/
+#ifdef CRC_CLMUL_ENABLED
+/**
+ * Folding constants, x^n mod P where P is 33 bits polynomial with the CRC polynomial aligned to MSB.
+ * Narrower CRC is folded as 32 bits CRC with polynomial P * x^(32 - width).
+ */
+typedef struct ClmulConstants_Tag
+{
+  uint64_t fold128[2];          ///< x^128 mod P, x^192 mod P, folds 16 bytes forward
+  uint64_t fold512[2];          ///< x^512 mod P, x^576 mod P, folds 64 bytes forward
+} ClmulConstants_T;
+#endif
+
+/** Kernels selected for the CPU by ResolveKernels, NULL kernel means that portable code is used */
+typedef struct CRC_Kernels_Tag
+{
+  uint32_t (*updateCrc32c)(uint32_t remainder, uint8_t const *data, size_t nBytes);
+  size_t (*updateCrc32cLanes)(uint32_t remainder[CRC_BATCH_LANES], uint8_t const * const data[], size_t nBytes);
+#ifdef CRC_CLMUL_ENABLED
+  size_t (*foldClmul)(uint8_t folded[16], uint32_t remainder, uint8_t const *data, size_t nBytes,
+                      ClmulConstants_T const *constants);
+#endif
+} CRC_Kernels_T;
 
 /*======================================================================================*/
 /*                         ####### OBJECT DEFINITIONS #######                           */
@@ -56,21 +134,1103 @@
 /*--------------------------------- EXPORTED OBJECTS -----------------------------------*/
 
 /*---------------------------------- LOCAL OBJECTS -------------------------------------*/
-static uint32_t Remainder = 0;
+/** Context of the legacy iterate API, CRC_CtxXxx functions should be used for concurrent streams */
+static CRC_Ctx_T IterateCtx = {CRC_CALC_SIZE_8, CRC8_INITIAL_VALUE};
+
+static CRC_Kernels_T Kernels;
+
+#if CRC_CALC_METHOD == CRC_CALC_METHOD_TABLE
+/* Entry i is remainder of the bitwise algorithm for byte i shifted to MSB, started from zero */
+static const uint8_t Crc8Table[256] =
+{
+  0x00, 0xE0, 0x20, 0xC0, 0x40, 0xA0, 0x60, 0x80, 0x80, 0x60, 0xA0, 0x40, 0xC0, 0x20, 0xE0, 0x00,
+  0xE0, 0x00, 0xC0, 0x20, 0xA0, 0x40, 0x80, 0x60, 0x60, 0x80, 0x40, 0xA0, 0x20, 0xC0, 0x00, 0xE0,
+  0x20, 0xC0, 0x00, 0xE0, 0x60, 0x80, 0x40, 0xA0, 0xA0, 0x40, 0x80, 0x60, 0xE0, 0x00, 0xC0, 0x20,
+  0xC0, 0x20, 0xE0, 0x00, 0x80, 0x60, 0xA0, 0x40, 0x40, 0xA0, 0x60, 0x80, 0x00, 0xE0, 0x20, 0xC0,
+  0x40, 0xA0, 0x60, 0x80, 0x00, 0xE0, 0x20, 0xC0, 0xC0, 0x20, 0xE0, 0x00, 0x80, 0x60, 0xA0, 0x40,
+  0xA0, 0x40, 0x80, 0x60, 0xE0, 0x00, 0xC0, 0x20, 0x20, 0xC0, 0x00, 0xE0, 0x60, 0x80, 0x40, 0xA0,
+  0x60, 0x80, 0x40, 0xA0, 0x20, 0xC0, 0x00, 0xE0, 0xE0, 0x00, 0xC0, 0x20, 0xA0, 0x40, 0x80, 0x60,
+  0x80, 0x60, 0xA0, 0x40, 0xC0, 0x20, 0xE0, 0x00, 0x00, 0xE0, 0x20, 0xC0, 0x40, 0xA0, 0x60, 0x80,
+  0x80, 0x60, 0xA0, 0x40, 0xC0, 0x20, 0xE0, 0x00, 0x00, 0xE0, 0x20, 0xC0, 0x40, 0xA0, 0x60, 0x80,
+  0x60, 0x80, 0x40, 0xA0, 0x20, 0xC0, 0x00, 0xE0, 0xE0, 0x00, 0xC0, 0x20, 0xA0, 0x40, 0x80, 0x60,
+  0xA0, 0x40, 0x80, 0x60, 0xE0, 0x00, 0xC0, 0x20, 0x20, 0xC0, 0x00, 0xE0, 0x60, 0x80, 0x40, 0xA0,
+  0x40, 0xA0, 0x60, 0x80, 0x00, 0xE0, 0x20, 0xC0, 0xC0, 0x20, 0xE0, 0x00, 0x80, 0x60, 0xA0, 0x40,
+  0xC0, 0x20, 0xE0, 0x00, 0x80, 0x60, 0xA0, 0x40, 0x40, 0xA0, 0x60, 0x80, 0x00, 0xE0, 0x20, 0xC0,
+  0x20, 0xC0, 0x00, 0xE0, 0x60, 0x80, 0x40, 0xA0, 0xA0, 0x40, 0x80, 0x60, 0xE0, 0x00, 0xC0, 0x20,
+  0xE0, 0x00, 0xC0, 0x20, 0xA0, 0x40, 0x80, 0x60, 0x60, 0x80, 0x40, 0xA0, 0x20, 0xC0, 0x00, 0xE0,
+  0x00, 0xE0, 0x20, 0xC0, 0x40, 0xA0, 0x60, 0x80, 0x80, 0x60, 0xA0, 0x40, 0xC0, 0x20, 0xE0, 0x00
+};
+
+static const uint16_t Crc16Table[256] =
+{
+  0x0000, 0x8408, 0x8C18, 0x0810, 0x9C38, 0x1830, 0x1020, 0x9428,
+  0xBC78, 0x3870, 0x3060, 0xB468, 0x2040, 0xA448, 0xAC58, 0x2850,
+  0xFCF8, 0x78F0, 0x70E0, 0xF4E8, 0x60C0, 0xE4C8, 0xECD8, 0x68D0,
+  0x4080, 0xC488, 0xCC98, 0x4890, 0xDCB8, 0x58B0, 0x50A0, 0xD4A8,
+  0x7DF8, 0xF9F0, 0xF1E0, 0x75E8, 0xE1C0, 0x65C8, 0x6DD8, 0xE9D0,
+  0xC180, 0x4588, 0x4D98, 0xC990, 0x5DB8, 0xD9B0, 0xD1A0, 0x55A8,
+  0x8100, 0x0508, 0x0D18, 0x8910, 0x1D38, 0x9930, 0x9120, 0x1528,
+  0x3D78, 0xB970, 0xB160, 0x3568, 0xA140, 0x2548, 0x2D58, 0xA950,
+  0xFBF0, 0x7FF8, 0x77E8, 0xF3E0, 0x67C8, 0xE3C0, 0xEBD0, 0x6FD8,
+  0x4788, 0xC380, 0xCB90, 0x4F98, 0xDBB0, 0x5FB8, 0x57A8, 0xD3A0,
+  0x0708, 0x8300, 0x8B10, 0x0F18, 0x9B30, 0x1F38, 0x1728, 0x9320,
+  0xBB70, 0x3F78, 0x3768, 0xB360, 0x2748, 0xA340, 0xAB50, 0x2F58,
+  0x8608, 0x0200, 0x0A10, 0x8E18, 0x1A30, 0x9E38, 0x9628, 0x1220,
+  0x3A70, 0xBE78, 0xB668, 0x3260, 0xA648, 0x2240, 0x2A50, 0xAE58,
+  0x7AF0, 0xFEF8, 0xF6E8, 0x72E0, 0xE6C8, 0x62C0, 0x6AD0, 0xEED8,
+  0xC688, 0x4280, 0x4A90, 0xCE98, 0x5AB0, 0xDEB8, 0xD6A8, 0x52A0,
+  0x73E8, 0xF7E0, 0xFFF0, 0x7BF8, 0xEFD0, 0x6BD8, 0x63C8, 0xE7C0,
+  0xCF90, 0x4B98, 0x4388, 0xC780, 0x53A8, 0xD7A0, 0xDFB0, 0x5BB8,
+  0x8F10, 0x0B18, 0x0308, 0x8700, 0x1328, 0x9720, 0x9F30, 0x1B38,
+  0x3368, 0xB760, 0xBF70, 0x3B78, 0xAF50, 0x2B58, 0x2348, 0xA740,
+  0x0E10, 0x8A18, 0x8208, 0x0600, 0x9228, 0x1620, 0x1E30, 0x9A38,
+  0xB268, 0x3660, 0x3E70, 0xBA78, 0x2E50, 0xAA58, 0xA248, 0x2640,
+  0xF2E8, 0x76E0, 0x7EF0, 0xFAF8, 0x6ED0, 0xEAD8, 0xE2C8, 0x66C0,
+  0x4E90, 0xCA98, 0xC288, 0x4680, 0xD2A8, 0x56A0, 0x5EB0, 0xDAB8,
+  0x8818, 0x0C10, 0x0400, 0x8008, 0x1420, 0x9028, 0x9838, 0x1C30,
+  0x3460, 0xB068, 0xB878, 0x3C70, 0xA858, 0x2C50, 0x2440, 0xA048,
+  0x74E0, 0xF0E8, 0xF8F8, 0x7CF0, 0xE8D8, 0x6CD0, 0x64C0, 0xE0C8,
+  0xC898, 0x4C90, 0x4480, 0xC088, 0x54A0, 0xD0A8, 0xD8B8, 0x5CB0,
+  0xF5E0, 0x71E8, 0x79F8, 0xFDF0, 0x69D8, 0xEDD0, 0xE5C0, 0x61C8,
+  0x4998, 0xCD90, 0xC580, 0x4188, 0xD5A0, 0x51A8, 0x59B8, 0xDDB0,
+  0x0918, 0x8D10, 0x8500, 0x0108, 0x9520, 0x1128, 0x1938, 0x9D30,
+  0xB560, 0x3168, 0x3978, 0xBD70, 0x2958, 0xAD50, 0xA540, 0x2148
+};
+
+static const uint32_t Crc32Table[256] =
+{
+  0x00000000, 0xEDB88320, 0x36C98560, 0xDB710640, 0x6D930AC0, 0x802B89E0, 0x5B5A8FA0, 0xB6E20C80,
+  0xDB261580, 0x369E96A0, 0xEDEF90E0, 0x005713C0, 0xB6B51F40, 0x5B0D9C60, 0x807C9A20, 0x6DC41900,
+  0x5BF4A820, 0xB64C2B00, 0x6D3D2D40, 0x8085AE60, 0x3667A2E0, 0xDBDF21C0, 0x00AE2780, 0xED16A4A0,
+  0x80D2BDA0, 0x6D6A3E80, 0xB61B38C0, 0x5BA3BBE0, 0xED41B760, 0x00F93440, 0xDB883200, 0x3630B120,
+  0xB7E95040, 0x5A51D360, 0x8120D520, 0x6C985600, 0xDA7A5A80, 0x37C2D9A0, 0xECB3DFE0, 0x010B5CC0,
+  0x6CCF45C0, 0x8177C6E0, 0x5A06C0A0, 0xB7BE4380, 0x015C4F00, 0xECE4CC20, 0x3795CA60, 0xDA2D4940,
+  0xEC1DF860, 0x01A57B40, 0xDAD47D00, 0x376CFE20, 0x818EF2A0, 0x6C367180, 0xB74777C0, 0x5AFFF4E0,
+  0x373BEDE0, 0xDA836EC0, 0x01F26880, 0xEC4AEBA0, 0x5AA8E720, 0xB7106400, 0x6C616240, 0x81D9E160,
+  0x826A23A0, 0x6FD2A080, 0xB4A3A6C0, 0x591B25E0, 0xEFF92960, 0x0241AA40, 0xD930AC00, 0x34882F20,
+  0x594C3620, 0xB4F4B500, 0x6F85B340, 0x823D3060, 0x34DF3CE0, 0xD967BFC0, 0x0216B980, 0xEFAE3AA0,
+  0xD99E8B80, 0x342608A0, 0xEF570EE0, 0x02EF8DC0, 0xB40D8140, 0x59B50260, 0x82C40420, 0x6F7C8700,
+  0x02B89E00, 0xEF001D20, 0x34711B60, 0xD9C99840, 0x6F2B94C0, 0x829317E0, 0x59E211A0, 0xB45A9280,
+  0x358373E0, 0xD83BF0C0, 0x034AF680, 0xEEF275A0, 0x58107920, 0xB5A8FA00, 0x6ED9FC40, 0x83617F60,
+  0xEEA56660, 0x031DE540, 0xD86CE300, 0x35D46020, 0x83366CA0, 0x6E8EEF80, 0xB5FFE9C0, 0x58476AE0,
+  0x6E77DBC0, 0x83CF58E0, 0x58BE5EA0, 0xB506DD80, 0x03E4D100, 0xEE5C5220, 0x352D5460, 0xD895D740,
+  0xB551CE40, 0x58E94D60, 0x83984B20, 0x6E20C800, 0xD8C2C480, 0x357A47A0, 0xEE0B41E0, 0x03B3C2C0,
+  0xE96CC460, 0x04D44740, 0xDFA54100, 0x321DC220, 0x84FFCEA0, 0x69474D80, 0xB2364BC0, 0x5F8EC8E0,
+  0x324AD1E0, 0xDFF252C0, 0x04835480, 0xE93BD7A0, 0x5FD9DB20, 0xB2615800, 0x69105E40, 0x84A8DD60,
+  0xB2986C40, 0x5F20EF60, 0x8451E920, 0x69E96A00, 0xDF0B6680, 0x32B3E5A0, 0xE9C2E3E0, 0x047A60C0,
+  0x69BE79C0, 0x8406FAE0, 0x5F77FCA0, 0xB2CF7F80, 0x042D7300, 0xE995F020, 0x32E4F660, 0xDF5C7540,
+  0x5E859420, 0xB33D1700, 0x684C1140, 0x85F49260, 0x33169EE0, 0xDEAE1DC0, 0x05DF1B80, 0xE86798A0,
+  0x85A381A0, 0x681B0280, 0xB36A04C0, 0x5ED287E0, 0xE8308B60, 0x05880840, 0xDEF90E00, 0x33418D20,
+  0x05713C00, 0xE8C9BF20, 0x33B8B960, 0xDE003A40, 0x68E236C0, 0x855AB5E0, 0x5E2BB3A0, 0xB3933080,
+  0xDE572980, 0x33EFAAA0, 0xE89EACE0, 0x05262FC0, 0xB3C42340, 0x5E7CA060, 0x850DA620, 0x68B52500,
+  0x6B06E7C0, 0x86BE64E0, 0x5DCF62A0, 0xB077E180, 0x0695ED00, 0xEB2D6E20, 0x305C6860, 0xDDE4EB40,
+  0xB020F240, 0x5D987160, 0x86E97720, 0x6B51F400, 0xDDB3F880, 0x300B7BA0, 0xEB7A7DE0, 0x06C2FEC0,
+  0x30F24FE0, 0xDD4ACCC0, 0x063BCA80, 0xEB8349A0, 0x5D614520, 0xB0D9C600, 0x6BA8C040, 0x86104360,
+  0xEBD45A60, 0x066CD940, 0xDD1DDF00, 0x30A55C20, 0x864750A0, 0x6BFFD380, 0xB08ED5C0, 0x5D3656E0,
+  0xDCEFB780, 0x315734A0, 0xEA2632E0, 0x079EB1C0, 0xB17CBD40, 0x5CC43E60, 0x87B53820, 0x6A0DBB00,
+  0x07C9A200, 0xEA712120, 0x31002760, 0xDCB8A440, 0x6A5AA8C0, 0x87E22BE0, 0x5C932DA0, 0xB12BAE80,
+  0x871B1FA0, 0x6AA39C80, 0xB1D29AC0, 0x5C6A19E0, 0xEA881560, 0x07309640, 0xDC419000, 0x31F91320,
+  0x5C3D0A20, 0xB1858900, 0x6AF48F40, 0x874C0C60, 0x31AE00E0, 0xDC1683C0, 0x07678580, 0xEADF06A0
+};
+
+/* Entry i is remainder of the reflected bitwise algorithm for byte i, started from zero */
+static const uint32_t Crc32cTable[256] =
+{
+  0x00000000, 0xF26B8303, 0xE13B70F7, 0x1350F3F4, 0xC79A971F, 0x35F1141C, 0x26A1E7E8, 0xD4CA64EB,
+  0x8AD958CF, 0x78B2DBCC, 0x6BE22838, 0x9989AB3B, 0x4D43CFD0, 0xBF284CD3, 0xAC78BF27, 0x5E133C24,
+  0x105EC76F, 0xE235446C, 0xF165B798, 0x030E349B, 0xD7C45070, 0x25AFD373, 0x36FF2087, 0xC494A384,
+  0x9A879FA0, 0x68EC1CA3, 0x7BBCEF57, 0x89D76C54, 0x5D1D08BF, 0xAF768BBC, 0xBC267848, 0x4E4DFB4B,
+  0x20BD8EDE, 0xD2D60DDD, 0xC186FE29, 0x33ED7D2A, 0xE72719C1, 0x154C9AC2, 0x061C6936, 0xF477EA35,
+  0xAA64D611, 0x580F5512, 0x4B5FA6E6, 0xB93425E5, 0x6DFE410E, 0x9F95C20D, 0x8CC531F9, 0x7EAEB2FA,
+  0x30E349B1, 0xC288CAB2, 0xD1D83946, 0x23B3BA45, 0xF779DEAE, 0x05125DAD, 0x1642AE59, 0xE4292D5A,
+  0xBA3A117E, 0x4851927D, 0x5B016189, 0xA96AE28A, 0x7DA08661, 0x8FCB0562, 0x9C9BF696, 0x6EF07595,
+  0x417B1DBC, 0xB3109EBF, 0xA0406D4B, 0x522BEE48, 0x86E18AA3, 0x748A09A0, 0x67DAFA54, 0x95B17957,
+  0xCBA24573, 0x39C9C670, 0x2A993584, 0xD8F2B687, 0x0C38D26C, 0xFE53516F, 0xED03A29B, 0x1F682198,
+  0x5125DAD3, 0xA34E59D0, 0xB01EAA24, 0x42752927, 0x96BF4DCC, 0x64D4CECF, 0x77843D3B, 0x85EFBE38,
+  0xDBFC821C, 0x2997011F, 0x3AC7F2EB, 0xC8AC71E8, 0x1C661503, 0xEE0D9600, 0xFD5D65F4, 0x0F36E6F7,
+  0x61C69362, 0x93AD1061, 0x80FDE395, 0x72966096, 0xA65C047D, 0x5437877E, 0x4767748A, 0xB50CF789,
+  0xEB1FCBAD, 0x197448AE, 0x0A24BB5A, 0xF84F3859, 0x2C855CB2, 0xDEEEDFB1, 0xCDBE2C45, 0x3FD5AF46,
+  0x7198540D, 0x83F3D70E, 0x90A324FA, 0x62C8A7F9, 0xB602C312, 0x44694011, 0x5739B3E5, 0xA55230E6,
+  0xFB410CC2, 0x092A8FC1, 0x1A7A7C35, 0xE811FF36, 0x3CDB9BDD, 0xCEB018DE, 0xDDE0EB2A, 0x2F8B6829,
+  0x82F63B78, 0x709DB87B, 0x63CD4B8F, 0x91A6C88C, 0x456CAC67, 0xB7072F64, 0xA457DC90, 0x563C5F93,
+  0x082F63B7, 0xFA44E0B4, 0xE9141340, 0x1B7F9043, 0xCFB5F4A8, 0x3DDE77AB, 0x2E8E845F, 0xDCE5075C,
+  0x92A8FC17, 0x60C37F14, 0x73938CE0, 0x81F80FE3, 0x55326B08, 0xA759E80B, 0xB4091BFF, 0x466298FC,
+  0x1871A4D8, 0xEA1A27DB, 0xF94AD42F, 0x0B21572C, 0xDFEB33C7, 0x2D80B0C4, 0x3ED04330, 0xCCBBC033,
+  0xA24BB5A6, 0x502036A5, 0x4370C551, 0xB11B4652, 0x65D122B9, 0x97BAA1BA, 0x84EA524E, 0x7681D14D,
+  0x2892ED69, 0xDAF96E6A, 0xC9A99D9E, 0x3BC21E9D, 0xEF087A76, 0x1D63F975, 0x0E330A81, 0xFC588982,
+  0xB21572C9, 0x407EF1CA, 0x532E023E, 0xA145813D, 0x758FE5D6, 0x87E466D5, 0x94B49521, 0x66DF1622,
+  0x38CC2A06, 0xCAA7A905, 0xD9F75AF1, 0x2B9CD9F2, 0xFF56BD19, 0x0D3D3E1A, 0x1E6DCDEE, 0xEC064EED,
+  0xC38D26C4, 0x31E6A5C7, 0x22B65633, 0xD0DDD530, 0x0417B1DB, 0xF67C32D8, 0xE52CC12C, 0x1747422F,
+  0x49547E0B, 0xBB3FFD08, 0xA86F0EFC, 0x5A048DFF, 0x8ECEE914, 0x7CA56A17, 0x6FF599E3, 0x9D9E1AE0,
+  0xD3D3E1AB, 0x21B862A8, 0x32E8915C, 0xC083125F, 0x144976B4, 0xE622F5B7, 0xF5720643, 0x07198540,
+  0x590AB964, 0xAB613A67, 0xB831C993, 0x4A5A4A90, 0x9E902E7B, 0x6CFBAD78, 0x7FAB5E8C, 0x8DC0DD8F,
+  0xE330A81A, 0x115B2B19, 0x020BD8ED, 0xF0605BEE, 0x24AA3F05, 0xD6C1BC06, 0xC5914FF2, 0x37FACCF1,
+  0x69E9F0D5, 0x9B8273D6, 0x88D28022, 0x7AB90321, 0xAE7367CA, 0x5C18E4C9, 0x4F48173D, 0xBD23943E,
+  0xF36E6F75, 0x0105EC76, 0x12551F82, 0xE03E9C81, 0x34F4F86A, 0xC69F7B69, 0xD5CF889D, 0x27A40B9E,
+  0x79B737BA, 0x8BDCB4B9, 0x988C474D, 0x6AE7C44E, 0xBE2DA0A5, 0x4C4623A6, 0x5F16D052, 0xAD7D5351
+};
+#elif CRC_CALC_METHOD == CRC_CALC_METHOD_NIBBLE
+/* Entry i is remainder of the bitwise algorithm for nibble i shifted to MSB, started from zero */
+static const uint8_t Crc8NibbleTable[16] =
+{
+  0x00, 0xE0, 0x20, 0xC0, 0x40, 0xA0, 0x60, 0x80, 0x80, 0x60, 0xA0, 0x40, 0xC0, 0x20, 0xE0, 0x00
+};
+
+static const uint16_t Crc16NibbleTable[16] =
+{
+  0x0000, 0x8408, 0x8C18, 0x0810, 0x9C38, 0x1830, 0x1020, 0x9428,
+  0xBC78, 0x3870, 0x3060, 0xB468, 0x2040, 0xA448, 0xAC58, 0x2850
+};
+
+static const uint32_t Crc32NibbleTable[16] =
+{
+  0x00000000, 0xEDB88320, 0x36C98560, 0xDB710640, 0x6D930AC0, 0x802B89E0, 0x5B5A8FA0, 0xB6E20C80,
+  0xDB261580, 0x369E96A0, 0xEDEF90E0, 0x005713C0, 0xB6B51F40, 0x5B0D9C60, 0x807C9A20, 0x6DC41900
+};
+
+/* Reflected, entry i is remainder of the LSB first algorithm for nibble i */
+static const uint32_t Crc32cNibbleTable[16] =
+{
+  0x00000000, 0x105EC76F, 0x20BD8EDE, 0x30E349B1, 0x417B1DBC, 0x5125DAD3, 0x61C69362, 0x7198540D,
+  0x82F63B78, 0x92A8FC17, 0xA24BB5A6, 0xB21572C9, 0xC38D26C4, 0xD3D3E1AB, 0xE330A81A, 0xF36E6F75
+};
+#endif
+
+#ifdef CRC32_SLICING_ENABLED
+/* Entry [n][i] is remainder for byte i followed by n + 1 zero bytes, Crc32Table is the slice for n = -1 */
+static const uint32_t Crc32SliceTable[CRC32_SLICING - 1][256] =
+{
+  {
+    0x00000000, 0x3F610BE0, 0x7EC217C0, 0x41A31C20, 0xFD842F80, 0xC2E52460, 0x83463840, 0xBC2733A0,
+    0x16B0DC20, 0x29D1D7C0, 0x6872CBE0, 0x5713C000, 0xEB34F3A0, 0xD455F840, 0x95F6E460, 0xAA97EF80,
+    0x2D61B840, 0x1200B3A0, 0x53A3AF80, 0x6CC2A460, 0xD0E597C0, 0xEF849C20, 0xAE278000, 0x91468BE0,
+    0x3BD16460, 0x04B06F80, 0x451373A0, 0x7A727840, 0xC6554BE0, 0xF9344000, 0xB8975C20, 0x87F657C0,
+    0x5AC37080, 0x65A27B60, 0x24016740, 0x1B606CA0, 0xA7475F00, 0x982654E0, 0xD98548C0, 0xE6E44320,
+    0x4C73ACA0, 0x7312A740, 0x32B1BB60, 0x0DD0B080, 0xB1F78320, 0x8E9688C0, 0xCF3594E0, 0xF0549F00,
+    0x77A2C8C0, 0x48C3C320, 0x0960DF00, 0x3601D4E0, 0x8A26E740, 0xB547ECA0, 0xF4E4F080, 0xCB85FB60,
+    0x611214E0, 0x5E731F00, 0x1FD00320, 0x20B108C0, 0x9C963B60, 0xA3F73080, 0xE2542CA0, 0xDD352740,
+    0xB586E100, 0x8AE7EAE0, 0xCB44F6C0, 0xF425FD20, 0x4802CE80, 0x7763C560, 0x36C0D940, 0x09A1D2A0,
+    0xA3363D20, 0x9C5736C0, 0xDDF42AE0, 0xE2952100, 0x5EB212A0, 0x61D31940, 0x20700560, 0x1F110E80,
+    0x98E75940, 0xA78652A0, 0xE6254E80, 0xD9444560, 0x656376C0, 0x5A027D20, 0x1BA16100, 0x24C06AE0,
+    0x8E578560, 0xB1368E80, 0xF09592A0, 0xCFF49940, 0x73D3AAE0, 0x4CB2A100, 0x0D11BD20, 0x3270B6C0,
+    0xEF459180, 0xD0249A60, 0x91878640, 0xAEE68DA0, 0x12C1BE00, 0x2DA0B5E0, 0x6C03A9C0, 0x5362A220,
+    0xF9F54DA0, 0xC6944640, 0x87375A60, 0xB8565180, 0x04716220, 0x3B1069C0, 0x7AB375E0, 0x45D27E00,
+    0xC22429C0, 0xFD452220, 0xBCE63E00, 0x838735E0, 0x3FA00640, 0x00C10DA0, 0x41621180, 0x7E031A60,
+    0xD494F5E0, 0xEBF5FE00, 0xAA56E220, 0x9537E9C0, 0x2910DA60, 0x1671D180, 0x57D2CDA0, 0x68B3C640,
+    0x86B54120, 0xB9D44AC0, 0xF87756E0, 0xC7165D00, 0x7B316EA0, 0x44506540, 0x05F37960, 0x3A927280,
+    0x90059D00, 0xAF6496E0, 0xEEC78AC0, 0xD1A68120, 0x6D81B280, 0x52E0B960, 0x1343A540, 0x2C22AEA0,
+    0xABD4F960, 0x94B5F280, 0xD516EEA0, 0xEA77E540, 0x5650D6E0, 0x6931DD00, 0x2892C120, 0x17F3CAC0,
+    0xBD642540, 0x82052EA0, 0xC3A63280, 0xFCC73960, 0x40E00AC0, 0x7F810120, 0x3E221D00, 0x014316E0,
+    0xDC7631A0, 0xE3173A40, 0xA2B42660, 0x9DD52D80, 0x21F21E20, 0x1E9315C0, 0x5F3009E0, 0x60510200,
+    0xCAC6ED80, 0xF5A7E660, 0xB404FA40, 0x8B65F1A0, 0x3742C200, 0x0823C9E0, 0x4980D5C0, 0x76E1DE20,
+    0xF11789E0, 0xCE768200, 0x8FD59E20, 0xB0B495C0, 0x0C93A660, 0x33F2AD80, 0x7251B1A0, 0x4D30BA40,
+    0xE7A755C0, 0xD8C65E20, 0x99654200, 0xA60449E0, 0x1A237A40, 0x254271A0, 0x64E16D80, 0x5B806660,
+    0x3333A020, 0x0C52ABC0, 0x4DF1B7E0, 0x7290BC00, 0xCEB78FA0, 0xF1D68440, 0xB0759860, 0x8F149380,
+    0x25837C00, 0x1AE277E0, 0x5B416BC0, 0x64206020, 0xD8075380, 0xE7665860, 0xA6C54440, 0x99A44FA0,
+    0x1E521860, 0x21331380, 0x60900FA0, 0x5FF10440, 0xE3D637E0, 0xDCB73C00, 0x9D142020, 0xA2752BC0,
+    0x08E2C440, 0x3783CFA0, 0x7620D380, 0x4941D860, 0xF566EBC0, 0xCA07E020, 0x8BA4FC00, 0xB4C5F7E0,
+    0x69F0D0A0, 0x5691DB40, 0x1732C760, 0x2853CC80, 0x9474FF20, 0xAB15F4C0, 0xEAB6E8E0, 0xD5D7E300,
+    0x7F400C80, 0x40210760, 0x01821B40, 0x3EE310A0, 0x82C42300, 0xBDA528E0, 0xFC0634C0, 0xC3673F20,
+    0x449168E0, 0x7BF06300, 0x3A537F20, 0x053274C0, 0xB9154760, 0x86744C80, 0xC7D750A0, 0xF8B65B40,
+    0x5221B4C0, 0x6D40BF20, 0x2CE3A300, 0x1382A8E0, 0xAFA59B40, 0x90C490A0, 0xD1678C80, 0xEE068760
+  },
+  {
+    0x00000000, 0xE0D20160, 0x2C1C81E0, 0xCCCE8080, 0x583903C0, 0xB8EB02A0, 0x74258220, 0x94F78340,
+    0xB0720780, 0x50A006E0, 0x9C6E8660, 0x7CBC8700, 0xE84B0440, 0x08990520, 0xC45785A0, 0x248584C0,
+    0x8D5C8C20, 0x6D8E8D40, 0xA1400DC0, 0x41920CA0, 0xD5658FE0, 0x35B78E80, 0xF9790E00, 0x19AB0F60,
+    0x3D2E8BA0, 0xDDFC8AC0, 0x11320A40, 0xF1E00B20, 0x65178860, 0x85C58900, 0x490B0980, 0xA9D908E0,
+    0xF7019B60, 0x17D39A00, 0xDB1D1A80, 0x3BCF1BE0, 0xAF3898A0, 0x4FEA99C0, 0x83241940, 0x63F61820,
+    0x47739CE0, 0xA7A19D80, 0x6B6F1D00, 0x8BBD1C60, 0x1F4A9F20, 0xFF989E40, 0x33561EC0, 0xD3841FA0,
+    0x7A5D1740, 0x9A8F1620, 0x564196A0, 0xB69397C0, 0x22641480, 0xC2B615E0, 0x0E789560, 0xEEAA9400,
+    0xCA2F10C0, 0x2AFD11A0, 0xE6339120, 0x06E19040, 0x92161300, 0x72C41260, 0xBE0A92E0, 0x5ED89380,
+    0x03BBB5E0, 0xE369B480, 0x2FA73400, 0xCF753560, 0x5B82B620, 0xBB50B740, 0x779E37C0, 0x974C36A0,
+    0xB3C9B260, 0x531BB300, 0x9FD53380, 0x7F0732E0, 0xEBF0B1A0, 0x0B22B0C0, 0xC7EC3040, 0x273E3120,
+    0x8EE739C0, 0x6E3538A0, 0xA2FBB820, 0x4229B940, 0xD6DE3A00, 0x360C3B60, 0xFAC2BBE0, 0x1A10BA80,
+    0x3E953E40, 0xDE473F20, 0x1289BFA0, 0xF25BBEC0, 0x66AC3D80, 0x867E3CE0, 0x4AB0BC60, 0xAA62BD00,
+    0xF4BA2E80, 0x14682FE0, 0xD8A6AF60, 0x3874AE00, 0xAC832D40, 0x4C512C20, 0x809FACA0, 0x604DADC0,
+    0x44C82900, 0xA41A2860, 0x68D4A8E0, 0x8806A980, 0x1CF12AC0, 0xFC232BA0, 0x30EDAB20, 0xD03FAA40,
+    0x79E6A2A0, 0x9934A3C0, 0x55FA2340, 0xB5282220, 0x21DFA160, 0xC10DA000, 0x0DC32080, 0xED1121E0,
+    0xC994A520, 0x2946A440, 0xE58824C0, 0x055A25A0, 0x91ADA6E0, 0x717FA780, 0xBDB12700, 0x5D632660,
+    0x07776BC0, 0xE7A56AA0, 0x2B6BEA20, 0xCBB9EB40, 0x5F4E6800, 0xBF9C6960, 0x7352E9E0, 0x9380E880,
+    0xB7056C40, 0x57D76D20, 0x9B19EDA0, 0x7BCBECC0, 0xEF3C6F80, 0x0FEE6EE0, 0xC320EE60, 0x23F2EF00,
+    0x8A2BE7E0, 0x6AF9E680, 0xA6376600, 0x46E56760, 0xD212E420, 0x32C0E540, 0xFE0E65C0, 0x1EDC64A0,
+    0x3A59E060, 0xDA8BE100, 0x16456180, 0xF69760E0, 0x6260E3A0, 0x82B2E2C0, 0x4E7C6240, 0xAEAE6320,
+    0xF076F0A0, 0x10A4F1C0, 0xDC6A7140, 0x3CB87020, 0xA84FF360, 0x489DF200, 0x84537280, 0x648173E0,
+    0x4004F720, 0xA0D6F640, 0x6C1876C0, 0x8CCA77A0, 0x183DF4E0, 0xF8EFF580, 0x34217500, 0xD4F37460,
+    0x7D2A7C80, 0x9DF87DE0, 0x5136FD60, 0xB1E4FC00, 0x25137F40, 0xC5C17E20, 0x090FFEA0, 0xE9DDFFC0,
+    0xCD587B00, 0x2D8A7A60, 0xE144FAE0, 0x0196FB80, 0x956178C0, 0x75B379A0, 0xB97DF920, 0x59AFF840,
+    0x04CCDE20, 0xE41EDF40, 0x28D05FC0, 0xC8025EA0, 0x5CF5DDE0, 0xBC27DC80, 0x70E95C00, 0x903B5D60,
+    0xB4BED9A0, 0x546CD8C0, 0x98A25840, 0x78705920, 0xEC87DA60, 0x0C55DB00, 0xC09B5B80, 0x20495AE0,
+    0x89905200, 0x69425360, 0xA58CD3E0, 0x455ED280, 0xD1A951C0, 0x317B50A0, 0xFDB5D020, 0x1D67D140,
+    0x39E25580, 0xD93054E0, 0x15FED460, 0xF52CD500, 0x61DB5640, 0x81095720, 0x4DC7D7A0, 0xAD15D6C0,
+    0xF3CD4540, 0x131F4420, 0xDFD1C4A0, 0x3F03C5C0, 0xABF44680, 0x4B2647E0, 0x87E8C760, 0x673AC600,
+    0x43BF42C0, 0xA36D43A0, 0x6FA3C320, 0x8F71C240, 0x1B864100, 0xFB544060, 0x379AC0E0, 0xD748C180,
+    0x7E91C960, 0x9E43C800, 0x528D4880, 0xB25F49E0, 0x26A8CAA0, 0xC67ACBC0, 0x0AB44B40, 0xEA664A20,
+    0xCEE3CEE0, 0x2E31CF80, 0xE2FF4F00, 0x022D4E60, 0x96DACD20, 0x7608CC40, 0xBAC64CC0, 0x5A144DA0
+  },
+  {
+    0x00000000, 0x0EEED780, 0x1DDDAF00, 0x13337880, 0x3BBB5E00, 0x35558980, 0x2666F100, 0x28882680,
+    0x7776BC00, 0x79986B80, 0x6AAB1300, 0x6445C480, 0x4CCDE200, 0x42233580, 0x51104D00, 0x5FFE9A80,
+    0xEEED7800, 0xE003AF80, 0xF330D700, 0xFDDE0080, 0xD5562600, 0xDBB8F180, 0xC88B8900, 0xC6655E80,
+    0x999BC400, 0x97751380, 0x84466B00, 0x8AA8BC80, 0xA2209A00, 0xACCE4D80, 0xBFFD3500, 0xB113E280,
+    0x30627320, 0x3E8CA4A0, 0x2DBFDC20, 0x23510BA0, 0x0BD92D20, 0x0537FAA0, 0x16048220, 0x18EA55A0,
+    0x4714CF20, 0x49FA18A0, 0x5AC96020, 0x5427B7A0, 0x7CAF9120, 0x724146A0, 0x61723E20, 0x6F9CE9A0,
+    0xDE8F0B20, 0xD061DCA0, 0xC352A420, 0xCDBC73A0, 0xE5345520, 0xEBDA82A0, 0xF8E9FA20, 0xF6072DA0,
+    0xA9F9B720, 0xA71760A0, 0xB4241820, 0xBACACFA0, 0x9242E920, 0x9CAC3EA0, 0x8F9F4620, 0x817191A0,
+    0x60C4E640, 0x6E2A31C0, 0x7D194940, 0x73F79EC0, 0x5B7FB840, 0x55916FC0, 0x46A21740, 0x484CC0C0,
+    0x17B25A40, 0x195C8DC0, 0x0A6FF540, 0x048122C0, 0x2C090440, 0x22E7D3C0, 0x31D4AB40, 0x3F3A7CC0,
+    0x8E299E40, 0x80C749C0, 0x93F43140, 0x9D1AE6C0, 0xB592C040, 0xBB7C17C0, 0xA84F6F40, 0xA6A1B8C0,
+    0xF95F2240, 0xF7B1F5C0, 0xE4828D40, 0xEA6C5AC0, 0xC2E47C40, 0xCC0AABC0, 0xDF39D340, 0xD1D704C0,
+    0x50A69560, 0x5E4842E0, 0x4D7B3A60, 0x4395EDE0, 0x6B1DCB60, 0x65F31CE0, 0x76C06460, 0x782EB3E0,
+    0x27D02960, 0x293EFEE0, 0x3A0D8660, 0x34E351E0, 0x1C6B7760, 0x1285A0E0, 0x01B6D860, 0x0F580FE0,
+    0xBE4BED60, 0xB0A53AE0, 0xA3964260, 0xAD7895E0, 0x85F0B360, 0x8B1E64E0, 0x982D1C60, 0x96C3CBE0,
+    0xC93D5160, 0xC7D386E0, 0xD4E0FE60, 0xDA0E29E0, 0xF2860F60, 0xFC68D8E0, 0xEF5BA060, 0xE1B577E0,
+    0xC189CC80, 0xCF671B00, 0xDC546380, 0xD2BAB400, 0xFA329280, 0xF4DC4500, 0xE7EF3D80, 0xE901EA00,
+    0xB6FF7080, 0xB811A700, 0xAB22DF80, 0xA5CC0800, 0x8D442E80, 0x83AAF900, 0x90998180, 0x9E775600,
+    0x2F64B480, 0x218A6300, 0x32B91B80, 0x3C57CC00, 0x14DFEA80, 0x1A313D00, 0x09024580, 0x07EC9200,
+    0x58120880, 0x56FCDF00, 0x45CFA780, 0x4B217000, 0x63A95680, 0x6D478100, 0x7E74F980, 0x709A2E00,
+    0xF1EBBFA0, 0xFF056820, 0xEC3610A0, 0xE2D8C720, 0xCA50E1A0, 0xC4BE3620, 0xD78D4EA0, 0xD9639920,
+    0x869D03A0, 0x8873D420, 0x9B40ACA0, 0x95AE7B20, 0xBD265DA0, 0xB3C88A20, 0xA0FBF2A0, 0xAE152520,
+    0x1F06C7A0, 0x11E81020, 0x02DB68A0, 0x0C35BF20, 0x24BD99A0, 0x2A534E20, 0x396036A0, 0x378EE120,
+    0x68707BA0, 0x669EAC20, 0x75ADD4A0, 0x7B430320, 0x53CB25A0, 0x5D25F220, 0x4E168AA0, 0x40F85D20,
+    0xA14D2AC0, 0xAFA3FD40, 0xBC9085C0, 0xB27E5240, 0x9AF674C0, 0x9418A340, 0x872BDBC0, 0x89C50C40,
+    0xD63B96C0, 0xD8D54140, 0xCBE639C0, 0xC508EE40, 0xED80C8C0, 0xE36E1F40, 0xF05D67C0, 0xFEB3B040,
+    0x4FA052C0, 0x414E8540, 0x527DFDC0, 0x5C932A40, 0x741B0CC0, 0x7AF5DB40, 0x69C6A3C0, 0x67287440,
+    0x38D6EEC0, 0x36383940, 0x250B41C0, 0x2BE59640, 0x036DB0C0, 0x0D836740, 0x1EB01FC0, 0x105EC840,
+    0x912F59E0, 0x9FC18E60, 0x8CF2F6E0, 0x821C2160, 0xAA9407E0, 0xA47AD060, 0xB749A8E0, 0xB9A77F60,
+    0xE659E5E0, 0xE8B73260, 0xFB844AE0, 0xF56A9D60, 0xDDE2BBE0, 0xD30C6C60, 0xC03F14E0, 0xCED1C360,
+    0x7FC221E0, 0x712CF660, 0x621F8EE0, 0x6CF15960, 0x44797FE0, 0x4A97A860, 0x59A4D0E0, 0x574A0760,
+    0x08B49DE0, 0x065A4A60, 0x156932E0, 0x1B87E560, 0x330FC3E0, 0x3DE11460, 0x2ED26CE0, 0x203CBB60
+  },
+  {
+    0x00000000, 0x6EAB1A20, 0xDD563440, 0xB3FD2E60, 0x5714EBA0, 0x39BFF180, 0x8A42DFE0, 0xE4E9C5C0,
+    0xAE29D740, 0xC082CD60, 0x737FE300, 0x1DD4F920, 0xF93D3CE0, 0x979626C0, 0x246B08A0, 0x4AC01280,
+    0xB1EB2DA0, 0xDF403780, 0x6CBD19E0, 0x021603C0, 0xE6FFC600, 0x8854DC20, 0x3BA9F240, 0x5502E860,
+    0x1FC2FAE0, 0x7169E0C0, 0xC294CEA0, 0xAC3FD480, 0x48D61140, 0x267D0B60, 0x95802500, 0xFB2B3F20,
+    0x8E6ED860, 0xE0C5C240, 0x5338EC20, 0x3D93F600, 0xD97A33C0, 0xB7D129E0, 0x042C0780, 0x6A871DA0,
+    0x20470F20, 0x4EEC1500, 0xFD113B60, 0x93BA2140, 0x7753E480, 0x19F8FEA0, 0xAA05D0C0, 0xC4AECAE0,
+    0x3F85F5C0, 0x512EEFE0, 0xE2D3C180, 0x8C78DBA0, 0x68911E60, 0x063A0440, 0xB5C72A20, 0xDB6C3000,
+    0x91AC2280, 0xFF0738A0, 0x4CFA16C0, 0x22510CE0, 0xC6B8C920, 0xA813D300, 0x1BEEFD60, 0x7545E740,
+    0xF16533E0, 0x9FCE29C0, 0x2C3307A0, 0x42981D80, 0xA671D840, 0xC8DAC260, 0x7B27EC00, 0x158CF620,
+    0x5F4CE4A0, 0x31E7FE80, 0x821AD0E0, 0xECB1CAC0, 0x08580F00, 0x66F31520, 0xD50E3B40, 0xBBA52160,
+    0x408E1E40, 0x2E250460, 0x9DD82A00, 0xF3733020, 0x179AF5E0, 0x7931EFC0, 0xCACCC1A0, 0xA467DB80,
+    0xEEA7C900, 0x800CD320, 0x33F1FD40, 0x5D5AE760, 0xB9B322A0, 0xD7183880, 0x64E516E0, 0x0A4E0CC0,
+    0x7F0BEB80, 0x11A0F1A0, 0xA25DDFC0, 0xCCF6C5E0, 0x281F0020, 0x46B41A00, 0xF5493460, 0x9BE22E40,
+    0xD1223CC0, 0xBF8926E0, 0x0C740880, 0x62DF12A0, 0x8636D760, 0xE89DCD40, 0x5B60E320, 0x35CBF900,
+    0xCEE0C620, 0xA04BDC00, 0x13B6F260, 0x7D1DE840, 0x99F42D80, 0xF75F37A0, 0x44A219C0, 0x2A0903E0,
+    0x60C91160, 0x0E620B40, 0xBD9F2520, 0xD3343F00, 0x37DDFAC0, 0x5976E0E0, 0xEA8BCE80, 0x8420D4A0,
+    0x0F72E4E0, 0x61D9FEC0, 0xD224D0A0, 0xBC8FCA80, 0x58660F40, 0x36CD1560, 0x85303B00, 0xEB9B2120,
+    0xA15B33A0, 0xCFF02980, 0x7C0D07E0, 0x12A61DC0, 0xF64FD800, 0x98E4C220, 0x2B19EC40, 0x45B2F660,
+    0xBE99C940, 0xD032D360, 0x63CFFD00, 0x0D64E720, 0xE98D22E0, 0x872638C0, 0x34DB16A0, 0x5A700C80,
+    0x10B01E00, 0x7E1B0420, 0xCDE62A40, 0xA34D3060, 0x47A4F5A0, 0x290FEF80, 0x9AF2C1E0, 0xF459DBC0,
+    0x811C3C80, 0xEFB726A0, 0x5C4A08C0, 0x32E112E0, 0xD608D720, 0xB8A3CD00, 0x0B5EE360, 0x65F5F940,
+    0x2F35EBC0, 0x419EF1E0, 0xF263DF80, 0x9CC8C5A0, 0x78210060, 0x168A1A40, 0xA5773420, 0xCBDC2E00,
+    0x30F71120, 0x5E5C0B00, 0xEDA12560, 0x830A3F40, 0x67E3FA80, 0x0948E0A0, 0xBAB5CEC0, 0xD41ED4E0,
+    0x9EDEC660, 0xF075DC40, 0x4388F220, 0x2D23E800, 0xC9CA2DC0, 0xA76137E0, 0x149C1980, 0x7A3703A0,
+    0xFE17D700, 0x90BCCD20, 0x2341E340, 0x4DEAF960, 0xA9033CA0, 0xC7A82680, 0x745508E0, 0x1AFE12C0,
+    0x503E0040, 0x3E951A60, 0x8D683400, 0xE3C32E20, 0x072AEBE0, 0x6981F1C0, 0xDA7CDFA0, 0xB4D7C580,
+    0x4FFCFAA0, 0x2157E080, 0x92AACEE0, 0xFC01D4C0, 0x18E81100, 0x76430B20, 0xC5BE2540, 0xAB153F60,
+    0xE1D52DE0, 0x8F7E37C0, 0x3C8319A0, 0x52280380, 0xB6C1C640, 0xD86ADC60, 0x6B97F200, 0x053CE820,
+    0x70790F60, 0x1ED21540, 0xAD2F3B20, 0xC3842100, 0x276DE4C0, 0x49C6FEE0, 0xFA3BD080, 0x9490CAA0,
+    0xDE50D820, 0xB0FBC200, 0x0306EC60, 0x6DADF640, 0x89443380, 0xE7EF29A0, 0x541207C0, 0x3AB91DE0,
+    0xC19222C0, 0xAF3938E0, 0x1CC41680, 0x726F0CA0, 0x9686C960, 0xF82DD340, 0x4BD0FD20, 0x257BE700,
+    0x6FBBF580, 0x0110EFA0, 0xB2EDC1C0, 0xDC46DBE0, 0x38AF1E20, 0x56040400, 0xE5F92A60, 0x8B523040
+  },
+  {
+    0x00000000, 0x1EE5C9C0, 0x3DCB9380, 0x232E5A40, 0x7B972700, 0x6572EEC0, 0x465CB480, 0x58B97D40,
+    0xF72E4E00, 0xE9CB87C0, 0xCAE5DD80, 0xD4001440, 0x8CB96900, 0x925CA0C0, 0xB172FA80, 0xAF973340,
+    0x03E41F20, 0x1D01D6E0, 0x3E2F8CA0, 0x20CA4560, 0x78733820, 0x6696F1E0, 0x45B8ABA0, 0x5B5D6260,
+    0xF4CA5120, 0xEA2F98E0, 0xC901C2A0, 0xD7E40B60, 0x8F5D7620, 0x91B8BFE0, 0xB296E5A0, 0xAC732C60,
+    0x07C83E40, 0x192DF780, 0x3A03ADC0, 0x24E66400, 0x7C5F1940, 0x62BAD080, 0x41948AC0, 0x5F714300,
+    0xF0E67040, 0xEE03B980, 0xCD2DE3C0, 0xD3C82A00, 0x8B715740, 0x95949E80, 0xB6BAC4C0, 0xA85F0D00,
+    0x042C2160, 0x1AC9E8A0, 0x39E7B2E0, 0x27027B20, 0x7FBB0660, 0x615ECFA0, 0x427095E0, 0x5C955C20,
+    0xF3026F60, 0xEDE7A6A0, 0xCEC9FCE0, 0xD02C3520, 0x88954860, 0x967081A0, 0xB55EDBE0, 0xABBB1220,
+    0x0F907C80, 0x1175B540, 0x325BEF00, 0x2CBE26C0, 0x74075B80, 0x6AE29240, 0x49CCC800, 0x572901C0,
+    0xF8BE3280, 0xE65BFB40, 0xC575A100, 0xDB9068C0, 0x83291580, 0x9DCCDC40, 0xBEE28600, 0xA0074FC0,
+    0x0C7463A0, 0x1291AA60, 0x31BFF020, 0x2F5A39E0, 0x77E344A0, 0x69068D60, 0x4A28D720, 0x54CD1EE0,
+    0xFB5A2DA0, 0xE5BFE460, 0xC691BE20, 0xD87477E0, 0x80CD0AA0, 0x9E28C360, 0xBD069920, 0xA3E350E0,
+    0x085842C0, 0x16BD8B00, 0x3593D140, 0x2B761880, 0x73CF65C0, 0x6D2AAC00, 0x4E04F640, 0x50E13F80,
+    0xFF760CC0, 0xE193C500, 0xC2BD9F40, 0xDC585680, 0x84E12BC0, 0x9A04E200, 0xB92AB840, 0xA7CF7180,
+    0x0BBC5DE0, 0x15599420, 0x3677CE60, 0x289207A0, 0x702B7AE0, 0x6ECEB320, 0x4DE0E960, 0x530520A0,
+    0xFC9213E0, 0xE277DA20, 0xC1598060, 0xDFBC49A0, 0x870534E0, 0x99E0FD20, 0xBACEA760, 0xA42B6EA0,
+    0x1F20F900, 0x01C530C0, 0x22EB6A80, 0x3C0EA340, 0x64B7DE00, 0x7A5217C0, 0x597C4D80, 0x47998440,
+    0xE80EB700, 0xF6EB7EC0, 0xD5C52480, 0xCB20ED40, 0x93999000, 0x8D7C59C0, 0xAE520380, 0xB0B7CA40,
+    0x1CC4E620, 0x02212FE0, 0x210F75A0, 0x3FEABC60, 0x6753C120, 0x79B608E0, 0x5A9852A0, 0x447D9B60,
+    0xEBEAA820, 0xF50F61E0, 0xD6213BA0, 0xC8C4F260, 0x907D8F20, 0x8E9846E0, 0xADB61CA0, 0xB353D560,
+    0x18E8C740, 0x060D0E80, 0x252354C0, 0x3BC69D00, 0x637FE040, 0x7D9A2980, 0x5EB473C0, 0x4051BA00,
+    0xEFC68940, 0xF1234080, 0xD20D1AC0, 0xCCE8D300, 0x9451AE40, 0x8AB46780, 0xA99A3DC0, 0xB77FF400,
+    0x1B0CD860, 0x05E911A0, 0x26C74BE0, 0x38228220, 0x609BFF60, 0x7E7E36A0, 0x5D506CE0, 0x43B5A520,
+    0xEC229660, 0xF2C75FA0, 0xD1E905E0, 0xCF0CCC20, 0x97B5B160, 0x895078A0, 0xAA7E22E0, 0xB49BEB20,
+    0x10B08580, 0x0E554C40, 0x2D7B1600, 0x339EDFC0, 0x6B27A280, 0x75C26B40, 0x56EC3100, 0x4809F8C0,
+    0xE79ECB80, 0xF97B0240, 0xDA555800, 0xC4B091C0, 0x9C09EC80, 0x82EC2540, 0xA1C27F00, 0xBF27B6C0,
+    0x13549AA0, 0x0DB15360, 0x2E9F0920, 0x307AC0E0, 0x68C3BDA0, 0x76267460, 0x55082E20, 0x4BEDE7E0,
+    0xE47AD4A0, 0xFA9F1D60, 0xD9B14720, 0xC7548EE0, 0x9FEDF3A0, 0x81083A60, 0xA2266020, 0xBCC3A9E0,
+    0x1778BBC0, 0x099D7200, 0x2AB32840, 0x3456E180, 0x6CEF9CC0, 0x720A5500, 0x51240F40, 0x4FC1C680,
+    0xE056F5C0, 0xFEB33C00, 0xDD9D6640, 0xC378AF80, 0x9BC1D2C0, 0x85241B00, 0xA60A4140, 0xB8EF8880,
+    0x149CA4E0, 0x0A796D20, 0x29573760, 0x37B2FEA0, 0x6F0B83E0, 0x71EE4A20, 0x52C01060, 0x4C25D9A0,
+    0xE3B2EAE0, 0xFD572320, 0xDE797960, 0xC09CB0A0, 0x9825CDE0, 0x86C00420, 0xA5EE5E60, 0xBB0B97A0
+  },
+  {
+    0x00000000, 0x3E41F200, 0x7C83E400, 0x42C21600, 0xF907C800, 0xC7463A00, 0x85842C00, 0xBBC5DE00,
+    0x1FB71320, 0x21F6E120, 0x6334F720, 0x5D750520, 0xE6B0DB20, 0xD8F12920, 0x9A333F20, 0xA472CD20,
+    0x3F6E2640, 0x012FD440, 0x43EDC240, 0x7DAC3040, 0xC669EE40, 0xF8281C40, 0xBAEA0A40, 0x84ABF840,
+    0x20D93560, 0x1E98C760, 0x5C5AD160, 0x621B2360, 0xD9DEFD60, 0xE79F0F60, 0xA55D1960, 0x9B1CEB60,
+    0x7EDC4C80, 0x409DBE80, 0x025FA880, 0x3C1E5A80, 0x87DB8480, 0xB99A7680, 0xFB586080, 0xC5199280,
+    0x616B5FA0, 0x5F2AADA0, 0x1DE8BBA0, 0x23A949A0, 0x986C97A0, 0xA62D65A0, 0xE4EF73A0, 0xDAAE81A0,
+    0x41B26AC0, 0x7FF398C0, 0x3D318EC0, 0x03707CC0, 0xB8B5A2C0, 0x86F450C0, 0xC43646C0, 0xFA77B4C0,
+    0x5E0579E0, 0x60448BE0, 0x22869DE0, 0x1CC76FE0, 0xA702B1E0, 0x994343E0, 0xDB8155E0, 0xE5C0A7E0,
+    0xFDB89900, 0xC3F96B00, 0x813B7D00, 0xBF7A8F00, 0x04BF5100, 0x3AFEA300, 0x783CB500, 0x467D4700,
+    0xE20F8A20, 0xDC4E7820, 0x9E8C6E20, 0xA0CD9C20, 0x1B084220, 0x2549B020, 0x678BA620, 0x59CA5420,
+    0xC2D6BF40, 0xFC974D40, 0xBE555B40, 0x8014A940, 0x3BD17740, 0x05908540, 0x47529340, 0x79136140,
+    0xDD61AC60, 0xE3205E60, 0xA1E24860, 0x9FA3BA60, 0x24666460, 0x1A279660, 0x58E58060, 0x66A47260,
+    0x8364D580, 0xBD252780, 0xFFE73180, 0xC1A6C380, 0x7A631D80, 0x4422EF80, 0x06E0F980, 0x38A10B80,
+    0x9CD3C6A0, 0xA29234A0, 0xE05022A0, 0xDE11D0A0, 0x65D40EA0, 0x5B95FCA0, 0x1957EAA0, 0x271618A0,
+    0xBC0AF3C0, 0x824B01C0, 0xC08917C0, 0xFEC8E5C0, 0x450D3BC0, 0x7B4CC9C0, 0x398EDFC0, 0x07CF2DC0,
+    0xA3BDE0E0, 0x9DFC12E0, 0xDF3E04E0, 0xE17FF6E0, 0x5ABA28E0, 0x64FBDAE0, 0x2639CCE0, 0x18783EE0,
+    0x16C9B120, 0x28884320, 0x6A4A5520, 0x540BA720, 0xEFCE7920, 0xD18F8B20, 0x934D9D20, 0xAD0C6F20,
+    0x097EA200, 0x373F5000, 0x75FD4600, 0x4BBCB400, 0xF0796A00, 0xCE389800, 0x8CFA8E00, 0xB2BB7C00,
+    0x29A79760, 0x17E66560, 0x55247360, 0x6B658160, 0xD0A05F60, 0xEEE1AD60, 0xAC23BB60, 0x92624960,
+    0x36108440, 0x08517640, 0x4A936040, 0x74D29240, 0xCF174C40, 0xF156BE40, 0xB394A840, 0x8DD55A40,
+    0x6815FDA0, 0x56540FA0, 0x149619A0, 0x2AD7EBA0, 0x911235A0, 0xAF53C7A0, 0xED91D1A0, 0xD3D023A0,
+    0x77A2EE80, 0x49E31C80, 0x0B210A80, 0x3560F880, 0x8EA52680, 0xB0E4D480, 0xF226C280, 0xCC673080,
+    0x577BDBE0, 0x693A29E0, 0x2BF83FE0, 0x15B9CDE0, 0xAE7C13E0, 0x903DE1E0, 0xD2FFF7E0, 0xECBE05E0,
+    0x48CCC8C0, 0x768D3AC0, 0x344F2CC0, 0x0A0EDEC0, 0xB1CB00C0, 0x8F8AF2C0, 0xCD48E4C0, 0xF30916C0,
+    0xEB712820, 0xD530DA20, 0x97F2CC20, 0xA9B33E20, 0x1276E020, 0x2C371220, 0x6EF50420, 0x50B4F620,
+    0xF4C63B00, 0xCA87C900, 0x8845DF00, 0xB6042D00, 0x0DC1F300, 0x33800100, 0x71421700, 0x4F03E500,
+    0xD41F0E60, 0xEA5EFC60, 0xA89CEA60, 0x96DD1860, 0x2D18C660, 0x13593460, 0x519B2260, 0x6FDAD060,
+    0xCBA81D40, 0xF5E9EF40, 0xB72BF940, 0x896A0B40, 0x32AFD540, 0x0CEE2740, 0x4E2C3140, 0x706DC340,
+    0x95AD64A0, 0xABEC96A0, 0xE92E80A0, 0xD76F72A0, 0x6CAAACA0, 0x52EB5EA0, 0x102948A0, 0x2E68BAA0,
+    0x8A1A7780, 0xB45B8580, 0xF6999380, 0xC8D86180, 0x731DBF80, 0x4D5C4D80, 0x0F9E5B80, 0x31DFA980,
+    0xAAC342E0, 0x9482B0E0, 0xD640A6E0, 0xE80154E0, 0x53C48AE0, 0x6D8578E0, 0x2F476EE0, 0x11069CE0,
+    0xB57451C0, 0x8B35A3C0, 0xC9F7B5C0, 0xF7B647C0, 0x4C7399C0, 0x72326BC0, 0x30F07DC0, 0x0EB18FC0
+  },
+  {
+    0x00000000, 0x2D936240, 0x5B26C480, 0x76B5A6C0, 0xB64D8900, 0x9BDEEB40, 0xED6B4D80, 0xC0F82FC0,
+    0x81239120, 0xACB0F360, 0xDA0555A0, 0xF79637E0, 0x376E1820, 0x1AFD7A60, 0x6C48DCA0, 0x41DBBEE0,
+    0xEFFFA160, 0xC26CC320, 0xB4D965E0, 0x994A07A0, 0x59B22860, 0x74214A20, 0x0294ECE0, 0x2F078EA0,
+    0x6EDC3040, 0x434F5200, 0x35FAF4C0, 0x18699680, 0xD891B940, 0xF502DB00, 0x83B77DC0, 0xAE241F80,
+    0x3247C1E0, 0x1FD4A3A0, 0x69610560, 0x44F26720, 0x840A48E0, 0xA9992AA0, 0xDF2C8C60, 0xF2BFEE20,
+    0xB36450C0, 0x9EF73280, 0xE8429440, 0xC5D1F600, 0x0529D9C0, 0x28BABB80, 0x5E0F1D40, 0x739C7F00,
+    0xDDB86080, 0xF02B02C0, 0x869EA400, 0xAB0DC640, 0x6BF5E980, 0x46668BC0, 0x30D32D00, 0x1D404F40,
+    0x5C9BF1A0, 0x710893E0, 0x07BD3520, 0x2A2E5760, 0xEAD678A0, 0xC7451AE0, 0xB1F0BC20, 0x9C63DE60,
+    0x648F83C0, 0x491CE180, 0x3FA94740, 0x123A2500, 0xD2C20AC0, 0xFF516880, 0x89E4CE40, 0xA477AC00,
+    0xE5AC12E0, 0xC83F70A0, 0xBE8AD660, 0x9319B420, 0x53E19BE0, 0x7E72F9A0, 0x08C75F60, 0x25543D20,
+    0x8B7022A0, 0xA6E340E0, 0xD056E620, 0xFDC58460, 0x3D3DABA0, 0x10AEC9E0, 0x661B6F20, 0x4B880D60,
+    0x0A53B380, 0x27C0D1C0, 0x51757700, 0x7CE61540, 0xBC1E3A80, 0x918D58C0, 0xE738FE00, 0xCAAB9C40,
+    0x56C84220, 0x7B5B2060, 0x0DEE86A0, 0x207DE4E0, 0xE085CB20, 0xCD16A960, 0xBBA30FA0, 0x96306DE0,
+    0xD7EBD300, 0xFA78B140, 0x8CCD1780, 0xA15E75C0, 0x61A65A00, 0x4C353840, 0x3A809E80, 0x1713FCC0,
+    0xB937E340, 0x94A48100, 0xE21127C0, 0xCF824580, 0x0F7A6A40, 0x22E90800, 0x545CAEC0, 0x79CFCC80,
+    0x38147260, 0x15871020, 0x6332B6E0, 0x4EA1D4A0, 0x8E59FB60, 0xA3CA9920, 0xD57F3FE0, 0xF8EC5DA0,
+    0xC91F0780, 0xE48C65C0, 0x9239C300, 0xBFAAA140, 0x7F528E80, 0x52C1ECC0, 0x24744A00, 0x09E72840,
+    0x483C96A0, 0x65AFF4E0, 0x131A5220, 0x3E893060, 0xFE711FA0, 0xD3E27DE0, 0xA557DB20, 0x88C4B960,
+    0x26E0A6E0, 0x0B73C4A0, 0x7DC66260, 0x50550020, 0x90AD2FE0, 0xBD3E4DA0, 0xCB8BEB60, 0xE6188920,
+    0xA7C337C0, 0x8A505580, 0xFCE5F340, 0xD1769100, 0x118EBEC0, 0x3C1DDC80, 0x4AA87A40, 0x673B1800,
+    0xFB58C660, 0xD6CBA420, 0xA07E02E0, 0x8DED60A0, 0x4D154F60, 0x60862D20, 0x16338BE0, 0x3BA0E9A0,
+    0x7A7B5740, 0x57E83500, 0x215D93C0, 0x0CCEF180, 0xCC36DE40, 0xE1A5BC00, 0x97101AC0, 0xBA837880,
+    0x14A76700, 0x39340540, 0x4F81A380, 0x6212C1C0, 0xA2EAEE00, 0x8F798C40, 0xF9CC2A80, 0xD45F48C0,
+    0x9584F620, 0xB8179460, 0xCEA232A0, 0xE33150E0, 0x23C97F20, 0x0E5A1D60, 0x78EFBBA0, 0x557CD9E0,
+    0xAD908440, 0x8003E600, 0xF6B640C0, 0xDB252280, 0x1BDD0D40, 0x364E6F00, 0x40FBC9C0, 0x6D68AB80,
+    0x2CB31560, 0x01207720, 0x7795D1E0, 0x5A06B3A0, 0x9AFE9C60, 0xB76DFE20, 0xC1D858E0, 0xEC4B3AA0,
+    0x426F2520, 0x6FFC4760, 0x1949E1A0, 0x34DA83E0, 0xF422AC20, 0xD9B1CE60, 0xAF0468A0, 0x82970AE0,
+    0xC34CB400, 0xEEDFD640, 0x986A7080, 0xB5F912C0, 0x75013D00, 0x58925F40, 0x2E27F980, 0x03B49BC0,
+    0x9FD745A0, 0xB24427E0, 0xC4F18120, 0xE962E360, 0x299ACCA0, 0x0409AEE0, 0x72BC0820, 0x5F2F6A60,
+    0x1EF4D480, 0x3367B6C0, 0x45D21000, 0x68417240, 0xA8B95D80, 0x852A3FC0, 0xF39F9900, 0xDE0CFB40,
+    0x7028E4C0, 0x5DBB8680, 0x2B0E2040, 0x069D4200, 0xC6656DC0, 0xEBF60F80, 0x9D43A940, 0xB0D0CB00,
+    0xF10B75E0, 0xDC9817A0, 0xAA2DB160, 0x87BED320, 0x4746FCE0, 0x6AD59EA0, 0x1C603860, 0x31F35A20
+  },
+#if CRC32_SLICING == 16
+  {
+    0x00000000, 0x7F868C20, 0xFF0D1840, 0x808B9460, 0x13A2B3A0, 0x6C243F80, 0xECAFABE0, 0x932927C0,
+    0x27456740, 0x58C3EB60, 0xD8487F00, 0xA7CEF320, 0x34E7D4E0, 0x4B6158C0, 0xCBEACCA0, 0xB46C4080,
+    0x4E8ACE80, 0x310C42A0, 0xB187D6C0, 0xCE015AE0, 0x5D287D20, 0x22AEF100, 0xA2256560, 0xDDA3E940,
+    0x69CFA9C0, 0x164925E0, 0x96C2B180, 0xE9443DA0, 0x7A6D1A60, 0x05EB9640, 0x85600220, 0xFAE68E00,
+    0x9D159D00, 0xE2931120, 0x62188540, 0x1D9E0960, 0x8EB72EA0, 0xF131A280, 0x71BA36E0, 0x0E3CBAC0,
+    0xBA50FA40, 0xC5D67660, 0x455DE200, 0x3ADB6E20, 0xA9F249E0, 0xD674C5C0, 0x56FF51A0, 0x2979DD80,
+    0xD39F5380, 0xAC19DFA0, 0x2C924BC0, 0x5314C7E0, 0xC03DE020, 0xBFBB6C00, 0x3F30F860, 0x40B67440,
+    0xF4DA34C0, 0x8B5CB8E0, 0x0BD72C80, 0x7451A0A0, 0xE7788760, 0x98FE0B40, 0x18759F20, 0x67F31300,
+    0xD793B920, 0xA8153500, 0x289EA160, 0x57182D40, 0xC4310A80, 0xBBB786A0, 0x3B3C12C0, 0x44BA9EE0,
+    0xF0D6DE60, 0x8F505240, 0x0FDBC620, 0x705D4A00, 0xE3746DC0, 0x9CF2E1E0, 0x1C797580, 0x63FFF9A0,
+    0x991977A0, 0xE69FFB80, 0x66146FE0, 0x1992E3C0, 0x8ABBC400, 0xF53D4820, 0x75B6DC40, 0x0A305060,
+    0xBE5C10E0, 0xC1DA9CC0, 0x415108A0, 0x3ED78480, 0xADFEA340, 0xD2782F60, 0x52F3BB00, 0x2D753720,
+    0x4A862420, 0x3500A800, 0xB58B3C60, 0xCA0DB040, 0x59249780, 0x26A21BA0, 0xA6298FC0, 0xD9AF03E0,
+    0x6DC34360, 0x1245CF40, 0x92CE5B20, 0xED48D700, 0x7E61F0C0, 0x01E77CE0, 0x816CE880, 0xFEEA64A0,
+    0x040CEAA0, 0x7B8A6680, 0xFB01F2E0, 0x84877EC0, 0x17AE5900, 0x6828D520, 0xE8A34140, 0x9725CD60,
+    0x23498DE0, 0x5CCF01C0, 0xDC4495A0, 0xA3C21980, 0x30EB3E40, 0x4F6DB260, 0xCFE62600, 0xB060AA20,
+    0x429FF160, 0x3D197D40, 0xBD92E920, 0xC2146500, 0x513D42C0, 0x2EBBCEE0, 0xAE305A80, 0xD1B6D6A0,
+    0x65DA9620, 0x1A5C1A00, 0x9AD78E60, 0xE5510240, 0x76782580, 0x09FEA9A0, 0x89753DC0, 0xF6F3B1E0,
+    0x0C153FE0, 0x7393B3C0, 0xF31827A0, 0x8C9EAB80, 0x1FB78C40, 0x60310060, 0xE0BA9400, 0x9F3C1820,
+    0x2B5058A0, 0x54D6D480, 0xD45D40E0, 0xABDBCCC0, 0x38F2EB00, 0x47746720, 0xC7FFF340, 0xB8797F60,
+    0xDF8A6C60, 0xA00CE040, 0x20877420, 0x5F01F800, 0xCC28DFC0, 0xB3AE53E0, 0x3325C780, 0x4CA34BA0,
+    0xF8CF0B20, 0x87498700, 0x07C21360, 0x78449F40, 0xEB6DB880, 0x94EB34A0, 0x1460A0C0, 0x6BE62CE0,
+    0x9100A2E0, 0xEE862EC0, 0x6E0DBAA0, 0x118B3680, 0x82A21140, 0xFD249D60, 0x7DAF0900, 0x02298520,
+    0xB645C5A0, 0xC9C34980, 0x4948DDE0, 0x36CE51C0, 0xA5E77600, 0xDA61FA20, 0x5AEA6E40, 0x256CE260,
+    0x950C4840, 0xEA8AC460, 0x6A015000, 0x1587DC20, 0x86AEFBE0, 0xF92877C0, 0x79A3E3A0, 0x06256F80,
+    0xB2492F00, 0xCDCFA320, 0x4D443740, 0x32C2BB60, 0xA1EB9CA0, 0xDE6D1080, 0x5EE684E0, 0x216008C0,
+    0xDB8686C0, 0xA4000AE0, 0x248B9E80, 0x5B0D12A0, 0xC8243560, 0xB7A2B940, 0x37292D20, 0x48AFA100,
+    0xFCC3E180, 0x83456DA0, 0x03CEF9C0, 0x7C4875E0, 0xEF615220, 0x90E7DE00, 0x106C4A60, 0x6FEAC640,
+    0x0819D540, 0x779F5960, 0xF714CD00, 0x88924120, 0x1BBB66E0, 0x643DEAC0, 0xE4B67EA0, 0x9B30F280,
+    0x2F5CB200, 0x50DA3E20, 0xD051AA40, 0xAFD72660, 0x3CFE01A0, 0x43788D80, 0xC3F319E0, 0xBC7595C0,
+    0x46931BC0, 0x391597E0, 0xB99E0380, 0xC6188FA0, 0x5531A860, 0x2AB72440, 0xAA3CB020, 0xD5BA3C00,
+    0x61D67C80, 0x1E50F0A0, 0x9EDB64C0, 0xE15DE8E0, 0x7274CF20, 0x0DF24300, 0x8D79D760, 0xF2FF5B40
+  },
+  {
+    0x00000000, 0x853FE2C0, 0xE7C746A0, 0x62F8A460, 0x22360E60, 0xA709ECA0, 0xC5F148C0, 0x40CEAA00,
+    0x446C1CC0, 0xC153FE00, 0xA3AB5A60, 0x2694B8A0, 0x665A12A0, 0xE365F060, 0x819D5400, 0x04A2B6C0,
+    0x88D83980, 0x0DE7DB40, 0x6F1F7F20, 0xEA209DE0, 0xAAEE37E0, 0x2FD1D520, 0x4D297140, 0xC8169380,
+    0xCCB42540, 0x498BC780, 0x2B7363E0, 0xAE4C8120, 0xEE822B20, 0x6BBDC9E0, 0x09456D80, 0x8C7A8F40,
+    0xFC08F020, 0x793712E0, 0x1BCFB680, 0x9EF05440, 0xDE3EFE40, 0x5B011C80, 0x39F9B8E0, 0xBCC65A20,
+    0xB864ECE0, 0x3D5B0E20, 0x5FA3AA40, 0xDA9C4880, 0x9A52E280, 0x1F6D0040, 0x7D95A420, 0xF8AA46E0,
+    0x74D0C9A0, 0xF1EF2B60, 0x93178F00, 0x16286DC0, 0x56E6C7C0, 0xD3D92500, 0xB1218160, 0x341E63A0,
+    0x30BCD560, 0xB58337A0, 0xD77B93C0, 0x52447100, 0x128ADB00, 0x97B539C0, 0xF54D9DA0, 0x70727F60,
+    0x15A96360, 0x909681A0, 0xF26E25C0, 0x7751C700, 0x379F6D00, 0xB2A08FC0, 0xD0582BA0, 0x5567C960,
+    0x51C57FA0, 0xD4FA9D60, 0xB6023900, 0x333DDBC0, 0x73F371C0, 0xF6CC9300, 0x94343760, 0x110BD5A0,
+    0x9D715AE0, 0x184EB820, 0x7AB61C40, 0xFF89FE80, 0xBF475480, 0x3A78B640, 0x58801220, 0xDDBFF0E0,
+    0xD91D4620, 0x5C22A4E0, 0x3EDA0080, 0xBBE5E240, 0xFB2B4840, 0x7E14AA80, 0x1CEC0EE0, 0x99D3EC20,
+    0xE9A19340, 0x6C9E7180, 0x0E66D5E0, 0x8B593720, 0xCB979D20, 0x4EA87FE0, 0x2C50DB80, 0xA96F3940,
+    0xADCD8F80, 0x28F26D40, 0x4A0AC920, 0xCF352BE0, 0x8FFB81E0, 0x0AC46320, 0x683CC740, 0xED032580,
+    0x6179AAC0, 0xE4464800, 0x86BEEC60, 0x03810EA0, 0x434FA4A0, 0xC6704660, 0xA488E200, 0x21B700C0,
+    0x2515B600, 0xA02A54C0, 0xC2D2F0A0, 0x47ED1260, 0x0723B860, 0x821C5AA0, 0xE0E4FEC0, 0x65DB1C00,
+    0x2B52C6C0, 0xAE6D2400, 0xCC958060, 0x49AA62A0, 0x0964C8A0, 0x8C5B2A60, 0xEEA38E00, 0x6B9C6CC0,
+    0x6F3EDA00, 0xEA0138C0, 0x88F99CA0, 0x0DC67E60, 0x4D08D460, 0xC83736A0, 0xAACF92C0, 0x2FF07000,
+    0xA38AFF40, 0x26B51D80, 0x444DB9E0, 0xC1725B20, 0x81BCF120, 0x048313E0, 0x667BB780, 0xE3445540,
+    0xE7E6E380, 0x62D90140, 0x0021A520, 0x851E47E0, 0xC5D0EDE0, 0x40EF0F20, 0x2217AB40, 0xA7284980,
+    0xD75A36E0, 0x5265D420, 0x309D7040, 0xB5A29280, 0xF56C3880, 0x7053DA40, 0x12AB7E20, 0x97949CE0,
+    0x93362A20, 0x1609C8E0, 0x74F16C80, 0xF1CE8E40, 0xB1002440, 0x343FC680, 0x56C762E0, 0xD3F88020,
+    0x5F820F60, 0xDABDEDA0, 0xB84549C0, 0x3D7AAB00, 0x7DB40100, 0xF88BE3C0, 0x9A7347A0, 0x1F4CA560,
+    0x1BEE13A0, 0x9ED1F160, 0xFC295500, 0x7916B7C0, 0x39D81DC0, 0xBCE7FF00, 0xDE1F5B60, 0x5B20B9A0,
+    0x3EFBA5A0, 0xBBC44760, 0xD93CE300, 0x5C0301C0, 0x1CCDABC0, 0x99F24900, 0xFB0AED60, 0x7E350FA0,
+    0x7A97B960, 0xFFA85BA0, 0x9D50FFC0, 0x186F1D00, 0x58A1B700, 0xDD9E55C0, 0xBF66F1A0, 0x3A591360,
+    0xB6239C20, 0x331C7EE0, 0x51E4DA80, 0xD4DB3840, 0x94159240, 0x112A7080, 0x73D2D4E0, 0xF6ED3620,
+    0xF24F80E0, 0x77706220, 0x1588C640, 0x90B72480, 0xD0798E80, 0x55466C40, 0x37BEC820, 0xB2812AE0,
+    0xC2F35580, 0x47CCB740, 0x25341320, 0xA00BF1E0, 0xE0C55BE0, 0x65FAB920, 0x07021D40, 0x823DFF80,
+    0x869F4940, 0x03A0AB80, 0x61580FE0, 0xE467ED20, 0xA4A94720, 0x2196A5E0, 0x436E0180, 0xC651E340,
+    0x4A2B6C00, 0xCF148EC0, 0xADEC2AA0, 0x28D3C860, 0x681D6260, 0xED2280A0, 0x8FDA24C0, 0x0AE5C600,
+    0x0E4770C0, 0x8B789200, 0xE9803660, 0x6CBFD4A0, 0x2C717EA0, 0xA94E9C60, 0xCBB63800, 0x4E89DAC0
+  },
+  {
+    0x00000000, 0x56A58D80, 0xAD4B1B00, 0xFBEE9680, 0xB72EB520, 0xE18B38A0, 0x1A65AE20, 0x4CC023A0,
+    0x83E5E960, 0xD54064E0, 0x2EAEF260, 0x780B7FE0, 0x34CB5C40, 0x626ED1C0, 0x99804740, 0xCF25CAC0,
+    0xEA7351E0, 0xBCD6DC60, 0x47384AE0, 0x119DC760, 0x5D5DE4C0, 0x0BF86940, 0xF016FFC0, 0xA6B37240,
+    0x6996B880, 0x3F333500, 0xC4DDA380, 0x92782E00, 0xDEB80DA0, 0x881D8020, 0x73F316A0, 0x25569B20,
+    0x395E20E0, 0x6FFBAD60, 0x94153BE0, 0xC2B0B660, 0x8E7095C0, 0xD8D51840, 0x233B8EC0, 0x759E0340,
+    0xBABBC980, 0xEC1E4400, 0x17F0D280, 0x41555F00, 0x0D957CA0, 0x5B30F120, 0xA0DE67A0, 0xF67BEA20,
+    0xD32D7100, 0x8588FC80, 0x7E666A00, 0x28C3E780, 0x6403C420, 0x32A649A0, 0xC948DF20, 0x9FED52A0,
+    0x50C89860, 0x066D15E0, 0xFD838360, 0xAB260EE0, 0xE7E62D40, 0xB143A0C0, 0x4AAD3640, 0x1C08BBC0,
+    0x72BC41C0, 0x2419CC40, 0xDFF75AC0, 0x8952D740, 0xC592F4E0, 0x93377960, 0x68D9EFE0, 0x3E7C6260,
+    0xF159A8A0, 0xA7FC2520, 0x5C12B3A0, 0x0AB73E20, 0x46771D80, 0x10D29000, 0xEB3C0680, 0xBD998B00,
+    0x98CF1020, 0xCE6A9DA0, 0x35840B20, 0x632186A0, 0x2FE1A500, 0x79442880, 0x82AABE00, 0xD40F3380,
+    0x1B2AF940, 0x4D8F74C0, 0xB661E240, 0xE0C46FC0, 0xAC044C60, 0xFAA1C1E0, 0x014F5760, 0x57EADAE0,
+    0x4BE26120, 0x1D47ECA0, 0xE6A97A20, 0xB00CF7A0, 0xFCCCD400, 0xAA695980, 0x5187CF00, 0x07224280,
+    0xC8078840, 0x9EA205C0, 0x654C9340, 0x33E91EC0, 0x7F293D60, 0x298CB0E0, 0xD2622660, 0x84C7ABE0,
+    0xA19130C0, 0xF734BD40, 0x0CDA2BC0, 0x5A7FA640, 0x16BF85E0, 0x401A0860, 0xBBF49EE0, 0xED511360,
+    0x2274D9A0, 0x74D15420, 0x8F3FC2A0, 0xD99A4F20, 0x955A6C80, 0xC3FFE100, 0x38117780, 0x6EB4FA00,
+    0xE5788380, 0xB3DD0E00, 0x48339880, 0x1E961500, 0x525636A0, 0x04F3BB20, 0xFF1D2DA0, 0xA9B8A020,
+    0x669D6AE0, 0x3038E760, 0xCBD671E0, 0x9D73FC60, 0xD1B3DFC0, 0x87165240, 0x7CF8C4C0, 0x2A5D4940,
+    0x0F0BD260, 0x59AE5FE0, 0xA240C960, 0xF4E544E0, 0xB8256740, 0xEE80EAC0, 0x156E7C40, 0x43CBF1C0,
+    0x8CEE3B00, 0xDA4BB680, 0x21A52000, 0x7700AD80, 0x3BC08E20, 0x6D6503A0, 0x968B9520, 0xC02E18A0,
+    0xDC26A360, 0x8A832EE0, 0x716DB860, 0x27C835E0, 0x6B081640, 0x3DAD9BC0, 0xC6430D40, 0x90E680C0,
+    0x5FC34A00, 0x0966C780, 0xF2885100, 0xA42DDC80, 0xE8EDFF20, 0xBE4872A0, 0x45A6E420, 0x130369A0,
+    0x3655F280, 0x60F07F00, 0x9B1EE980, 0xCDBB6400, 0x817B47A0, 0xD7DECA20, 0x2C305CA0, 0x7A95D120,
+    0xB5B01BE0, 0xE3159660, 0x18FB00E0, 0x4E5E8D60, 0x029EAEC0, 0x543B2340, 0xAFD5B5C0, 0xF9703840,
+    0x97C4C240, 0xC1614FC0, 0x3A8FD940, 0x6C2A54C0, 0x20EA7760, 0x764FFAE0, 0x8DA16C60, 0xDB04E1E0,
+    0x14212B20, 0x4284A6A0, 0xB96A3020, 0xEFCFBDA0, 0xA30F9E00, 0xF5AA1380, 0x0E448500, 0x58E10880,
+    0x7DB793A0, 0x2B121E20, 0xD0FC88A0, 0x86590520, 0xCA992680, 0x9C3CAB00, 0x67D23D80, 0x3177B000,
+    0xFE527AC0, 0xA8F7F740, 0x531961C0, 0x05BCEC40, 0x497CCFE0, 0x1FD94260, 0xE437D4E0, 0xB2925960,
+    0xAE9AE2A0, 0xF83F6F20, 0x03D1F9A0, 0x55747420, 0x19B45780, 0x4F11DA00, 0xB4FF4C80, 0xE25AC100,
+    0x2D7F0BC0, 0x7BDA8640, 0x803410C0, 0xD6919D40, 0x9A51BEE0, 0xCCF43360, 0x371AA5E0, 0x61BF2860,
+    0x44E9B340, 0x124C3EC0, 0xE9A2A840, 0xBF0725C0, 0xF3C70660, 0xA5628BE0, 0x5E8C1D60, 0x082990E0,
+    0xC70C5A20, 0x91A9D7A0, 0x6A474120, 0x3CE2CCA0, 0x7022EF00, 0x26876280, 0xDD69F400, 0x8BCC7980
+  },
+  {
+    0x00000000, 0x27498420, 0x4E930840, 0x69DA8C60, 0x9D261080, 0xBA6F94A0, 0xD3B518C0, 0xF4FC9CE0,
+    0xD7F4A220, 0xF0BD2600, 0x9967AA60, 0xBE2E2E40, 0x4AD2B2A0, 0x6D9B3680, 0x0441BAE0, 0x23083EC0,
+    0x4251C760, 0x65184340, 0x0CC2CF20, 0x2B8B4B00, 0xDF77D7E0, 0xF83E53C0, 0x91E4DFA0, 0xB6AD5B80,
+    0x95A56540, 0xB2ECE160, 0xDB366D00, 0xFC7FE920, 0x088375C0, 0x2FCAF1E0, 0x46107D80, 0x6159F9A0,
+    0x84A38EC0, 0xA3EA0AE0, 0xCA308680, 0xED7902A0, 0x19859E40, 0x3ECC1A60, 0x57169600, 0x705F1220,
+    0x53572CE0, 0x741EA8C0, 0x1DC424A0, 0x3A8DA080, 0xCE713C60, 0xE938B840, 0x80E23420, 0xA7ABB000,
+    0xC6F249A0, 0xE1BBCD80, 0x886141E0, 0xAF28C5C0, 0x5BD45920, 0x7C9DDD00, 0x15475160, 0x320ED540,
+    0x1106EB80, 0x364F6FA0, 0x5F95E3C0, 0x78DC67E0, 0x8C20FB00, 0xAB697F20, 0xC2B3F340, 0xE5FA7760,
+    0xE4FF9EA0, 0xC3B61A80, 0xAA6C96E0, 0x8D2512C0, 0x79D98E20, 0x5E900A00, 0x374A8660, 0x10030240,
+    0x330B3C80, 0x1442B8A0, 0x7D9834C0, 0x5AD1B0E0, 0xAE2D2C00, 0x8964A820, 0xE0BE2440, 0xC7F7A060,
+    0xA6AE59C0, 0x81E7DDE0, 0xE83D5180, 0xCF74D5A0, 0x3B884940, 0x1CC1CD60, 0x751B4100, 0x5252C520,
+    0x715AFBE0, 0x56137FC0, 0x3FC9F3A0, 0x18807780, 0xEC7CEB60, 0xCB356F40, 0xA2EFE320, 0x85A66700,
+    0x605C1060, 0x47159440, 0x2ECF1820, 0x09869C00, 0xFD7A00E0, 0xDA3384C0, 0xB3E908A0, 0x94A08C80,
+    0xB7A8B240, 0x90E13660, 0xF93BBA00, 0xDE723E20, 0x2A8EA2C0, 0x0DC726E0, 0x641DAA80, 0x43542EA0,
+    0x220DD700, 0x05445320, 0x6C9EDF40, 0x4BD75B60, 0xBF2BC780, 0x986243A0, 0xF1B8CFC0, 0xD6F14BE0,
+    0xF5F97520, 0xD2B0F100, 0xBB6A7D60, 0x9C23F940, 0x68DF65A0, 0x4F96E180, 0x264C6DE0, 0x0105E9C0,
+    0x2447BE60, 0x030E3A40, 0x6AD4B620, 0x4D9D3200, 0xB961AEE0, 0x9E282AC0, 0xF7F2A6A0, 0xD0BB2280,
+    0xF3B31C40, 0xD4FA9860, 0xBD201400, 0x9A699020, 0x6E950CC0, 0x49DC88E0, 0x20060480, 0x074F80A0,
+    0x66167900, 0x415FFD20, 0x28857140, 0x0FCCF560, 0xFB306980, 0xDC79EDA0, 0xB5A361C0, 0x92EAE5E0,
+    0xB1E2DB20, 0x96AB5F00, 0xFF71D360, 0xD8385740, 0x2CC4CBA0, 0x0B8D4F80, 0x6257C3E0, 0x451E47C0,
+    0xA0E430A0, 0x87ADB480, 0xEE7738E0, 0xC93EBCC0, 0x3DC22020, 0x1A8BA400, 0x73512860, 0x5418AC40,
+    0x77109280, 0x505916A0, 0x39839AC0, 0x1ECA1EE0, 0xEA368200, 0xCD7F0620, 0xA4A58A40, 0x83EC0E60,
+    0xE2B5F7C0, 0xC5FC73E0, 0xAC26FF80, 0x8B6F7BA0, 0x7F93E740, 0x58DA6360, 0x3100EF00, 0x16496B20,
+    0x354155E0, 0x1208D1C0, 0x7BD25DA0, 0x5C9BD980, 0xA8674560, 0x8F2EC140, 0xE6F44D20, 0xC1BDC900,
+    0xC0B820C0, 0xE7F1A4E0, 0x8E2B2880, 0xA962ACA0, 0x5D9E3040, 0x7AD7B460, 0x130D3800, 0x3444BC20,
+    0x174C82E0, 0x300506C0, 0x59DF8AA0, 0x7E960E80, 0x8A6A9260, 0xAD231640, 0xC4F99A20, 0xE3B01E00,
+    0x82E9E7A0, 0xA5A06380, 0xCC7AEFE0, 0xEB336BC0, 0x1FCFF720, 0x38867300, 0x515CFF60, 0x76157B40,
+    0x551D4580, 0x7254C1A0, 0x1B8E4DC0, 0x3CC7C9E0, 0xC83B5500, 0xEF72D120, 0x86A85D40, 0xA1E1D960,
+    0x441BAE00, 0x63522A20, 0x0A88A640, 0x2DC12260, 0xD93DBE80, 0xFE743AA0, 0x97AEB6C0, 0xB0E732E0,
+    0x93EF0C20, 0xB4A68800, 0xDD7C0460, 0xFA358040, 0x0EC91CA0, 0x29809880, 0x405A14E0, 0x671390C0,
+    0x064A6960, 0x2103ED40, 0x48D96120, 0x6F90E500, 0x9B6C79E0, 0xBC25FDC0, 0xD5FF71A0, 0xF2B6F580,
+    0xD1BECB40, 0xF6F74F60, 0x9F2DC300, 0xB8644720, 0x4C98DBC0, 0x6BD15FE0, 0x020BD380, 0x254257A0
+  },
+  {
+    0x00000000, 0x488F7CC0, 0x911EF980, 0xD9918540, 0xCF857020, 0x870A0CE0, 0x5E9B89A0, 0x1614F560,
+    0x72B26360, 0x3A3D1FA0, 0xE3AC9AE0, 0xAB23E620, 0xBD371340, 0xF5B86F80, 0x2C29EAC0, 0x64A69600,
+    0xE564C6C0, 0xADEBBA00, 0x747A3F40, 0x3CF54380, 0x2AE1B6E0, 0x626ECA20, 0xBBFF4F60, 0xF37033A0,
+    0x97D6A5A0, 0xDF59D960, 0x06C85C20, 0x4E4720E0, 0x5853D580, 0x10DCA940, 0xC94D2C00, 0x81C250C0,
+    0x27710EA0, 0x6FFE7260, 0xB66FF720, 0xFEE08BE0, 0xE8F47E80, 0xA07B0240, 0x79EA8700, 0x3165FBC0,
+    0x55C36DC0, 0x1D4C1100, 0xC4DD9440, 0x8C52E880, 0x9A461DE0, 0xD2C96120, 0x0B58E460, 0x43D798A0,
+    0xC215C860, 0x8A9AB4A0, 0x530B31E0, 0x1B844D20, 0x0D90B840, 0x451FC480, 0x9C8E41C0, 0xD4013D00,
+    0xB0A7AB00, 0xF828D7C0, 0x21B95280, 0x69362E40, 0x7F22DB20, 0x37ADA7E0, 0xEE3C22A0, 0xA6B35E60,
+    0x4EE21D40, 0x066D6180, 0xDFFCE4C0, 0x97739800, 0x81676D60, 0xC9E811A0, 0x107994E0, 0x58F6E820,
+    0x3C507E20, 0x74DF02E0, 0xAD4E87A0, 0xE5C1FB60, 0xF3D50E00, 0xBB5A72C0, 0x62CBF780, 0x2A448B40,
+    0xAB86DB80, 0xE309A740, 0x3A982200, 0x72175EC0, 0x6403ABA0, 0x2C8CD760, 0xF51D5220, 0xBD922EE0,
+    0xD934B8E0, 0x91BBC420, 0x482A4160, 0x00A53DA0, 0x16B1C8C0, 0x5E3EB400, 0x87AF3140, 0xCF204D80,
+    0x699313E0, 0x211C6F20, 0xF88DEA60, 0xB00296A0, 0xA61663C0, 0xEE991F00, 0x37089A40, 0x7F87E680,
+    0x1B217080, 0x53AE0C40, 0x8A3F8900, 0xC2B0F5C0, 0xD4A400A0, 0x9C2B7C60, 0x45BAF920, 0x0D3585E0,
+    0x8CF7D520, 0xC478A9E0, 0x1DE92CA0, 0x55665060, 0x4372A500, 0x0BFDD9C0, 0xD26C5C80, 0x9AE32040,
+    0xFE45B640, 0xB6CACA80, 0x6F5B4FC0, 0x27D43300, 0x31C0C660, 0x794FBAA0, 0xA0DE3FE0, 0xE8514320,
+    0x9DC43A80, 0xD54B4640, 0x0CDAC300, 0x4455BFC0, 0x52414AA0, 0x1ACE3660, 0xC35FB320, 0x8BD0CFE0,
+    0xEF7659E0, 0xA7F92520, 0x7E68A060, 0x36E7DCA0, 0x20F329C0, 0x687C5500, 0xB1EDD040, 0xF962AC80,
+    0x78A0FC40, 0x302F8080, 0xE9BE05C0, 0xA1317900, 0xB7258C60, 0xFFAAF0A0, 0x263B75E0, 0x6EB40920,
+    0x0A129F20, 0x429DE3E0, 0x9B0C66A0, 0xD3831A60, 0xC597EF00, 0x8D1893C0, 0x54891680, 0x1C066A40,
+    0xBAB53420, 0xF23A48E0, 0x2BABCDA0, 0x6324B160, 0x75304400, 0x3DBF38C0, 0xE42EBD80, 0xACA1C140,
+    0xC8075740, 0x80882B80, 0x5919AEC0, 0x1196D200, 0x07822760, 0x4F0D5BA0, 0x969CDEE0, 0xDE13A220,
+    0x5FD1F2E0, 0x175E8E20, 0xCECF0B60, 0x864077A0, 0x905482C0, 0xD8DBFE00, 0x014A7B40, 0x49C50780,
+    0x2D639180, 0x65ECED40, 0xBC7D6800, 0xF4F214C0, 0xE2E6E1A0, 0xAA699D60, 0x73F81820, 0x3B7764E0,
+    0xD32627C0, 0x9BA95B00, 0x4238DE40, 0x0AB7A280, 0x1CA357E0, 0x542C2B20, 0x8DBDAE60, 0xC532D2A0,
+    0xA19444A0, 0xE91B3860, 0x308ABD20, 0x7805C1E0, 0x6E113480, 0x269E4840, 0xFF0FCD00, 0xB780B1C0,
+    0x3642E100, 0x7ECD9DC0, 0xA75C1880, 0xEFD36440, 0xF9C79120, 0xB148EDE0, 0x68D968A0, 0x20561460,
+    0x44F08260, 0x0C7FFEA0, 0xD5EE7BE0, 0x9D610720, 0x8B75F240, 0xC3FA8E80, 0x1A6B0BC0, 0x52E47700,
+    0xF4572960, 0xBCD855A0, 0x6549D0E0, 0x2DC6AC20, 0x3BD25940, 0x735D2580, 0xAACCA0C0, 0xE243DC00,
+    0x86E54A00, 0xCE6A36C0, 0x17FBB380, 0x5F74CF40, 0x49603A20, 0x01EF46E0, 0xD87EC3A0, 0x90F1BF60,
+    0x1133EFA0, 0x59BC9360, 0x802D1620, 0xC8A26AE0, 0xDEB69F80, 0x9639E340, 0x4FA86600, 0x07271AC0,
+    0x63818CC0, 0x2B0EF000, 0xF29F7540, 0xBA100980, 0xAC04FCE0, 0xE48B8020, 0x3D1A0560, 0x759579A0
+  },
+  {
+    0x00000000, 0xD630F620, 0x41D96F60, 0x97E99940, 0x83B2DEC0, 0x558228E0, 0xC26BB1A0, 0x145B4780,
+    0xEADD3EA0, 0x3CEDC880, 0xAB0451C0, 0x7D34A7E0, 0x696FE060, 0xBF5F1640, 0x28B68F00, 0xFE867920,
+    0x3802FE60, 0xEE320840, 0x79DB9100, 0xAFEB6720, 0xBBB020A0, 0x6D80D680, 0xFA694FC0, 0x2C59B9E0,
+    0xD2DFC0C0, 0x04EF36E0, 0x9306AFA0, 0x45365980, 0x516D1E00, 0x875DE820, 0x10B47160, 0xC6848740,
+    0x7005FCC0, 0xA6350AE0, 0x31DC93A0, 0xE7EC6580, 0xF3B72200, 0x2587D420, 0xB26E4D60, 0x645EBB40,
+    0x9AD8C260, 0x4CE83440, 0xDB01AD00, 0x0D315B20, 0x196A1CA0, 0xCF5AEA80, 0x58B373C0, 0x8E8385E0,
+    0x480702A0, 0x9E37F480, 0x09DE6DC0, 0xDFEE9BE0, 0xCBB5DC60, 0x1D852A40, 0x8A6CB300, 0x5C5C4520,
+    0xA2DA3C00, 0x74EACA20, 0xE3035360, 0x3533A540, 0x2168E2C0, 0xF75814E0, 0x60B18DA0, 0xB6817B80,
+    0xE00BF980, 0x363B0FA0, 0xA1D296E0, 0x77E260C0, 0x63B92740, 0xB589D160, 0x22604820, 0xF450BE00,
+    0x0AD6C720, 0xDCE63100, 0x4B0FA840, 0x9D3F5E60, 0x896419E0, 0x5F54EFC0, 0xC8BD7680, 0x1E8D80A0,
+    0xD80907E0, 0x0E39F1C0, 0x99D06880, 0x4FE09EA0, 0x5BBBD920, 0x8D8B2F00, 0x1A62B640, 0xCC524060,
+    0x32D43940, 0xE4E4CF60, 0x730D5620, 0xA53DA000, 0xB166E780, 0x675611A0, 0xF0BF88E0, 0x268F7EC0,
+    0x900E0540, 0x463EF360, 0xD1D76A20, 0x07E79C00, 0x13BCDB80, 0xC58C2DA0, 0x5265B4E0, 0x845542C0,
+    0x7AD33BE0, 0xACE3CDC0, 0x3B0A5480, 0xED3AA2A0, 0xF961E520, 0x2F511300, 0xB8B88A40, 0x6E887C60,
+    0xA80CFB20, 0x7E3C0D00, 0xE9D59440, 0x3FE56260, 0x2BBE25E0, 0xFD8ED3C0, 0x6A674A80, 0xBC57BCA0,
+    0x42D1C580, 0x94E133A0, 0x0308AAE0, 0xD5385CC0, 0xC1631B40, 0x1753ED60, 0x80BA7420, 0x568A8200,
+    0x2DAF7020, 0xFB9F8600, 0x6C761F40, 0xBA46E960, 0xAE1DAEE0, 0x782D58C0, 0xEFC4C180, 0x39F437A0,
+    0xC7724E80, 0x1142B8A0, 0x86AB21E0, 0x509BD7C0, 0x44C09040, 0x92F06660, 0x0519FF20, 0xD3290900,
+    0x15AD8E40, 0xC39D7860, 0x5474E120, 0x82441700, 0x961F5080, 0x402FA6A0, 0xD7C63FE0, 0x01F6C9C0,
+    0xFF70B0E0, 0x294046C0, 0xBEA9DF80, 0x689929A0, 0x7CC26E20, 0xAAF29800, 0x3D1B0140, 0xEB2BF760,
+    0x5DAA8CE0, 0x8B9A7AC0, 0x1C73E380, 0xCA4315A0, 0xDE185220, 0x0828A400, 0x9FC13D40, 0x49F1CB60,
+    0xB777B240, 0x61474460, 0xF6AEDD20, 0x209E2B00, 0x34C56C80, 0xE2F59AA0, 0x751C03E0, 0xA32CF5C0,
+    0x65A87280, 0xB39884A0, 0x24711DE0, 0xF241EBC0, 0xE61AAC40, 0x302A5A60, 0xA7C3C320, 0x71F33500,
+    0x8F754C20, 0x5945BA00, 0xCEAC2340, 0x189CD560, 0x0CC792E0, 0xDAF764C0, 0x4D1EFD80, 0x9B2E0BA0,
+    0xCDA489A0, 0x1B947F80, 0x8C7DE6C0, 0x5A4D10E0, 0x4E165760, 0x9826A140, 0x0FCF3800, 0xD9FFCE20,
+    0x2779B700, 0xF1494120, 0x66A0D860, 0xB0902E40, 0xA4CB69C0, 0x72FB9FE0, 0xE51206A0, 0x3322F080,
+    0xF5A677C0, 0x239681E0, 0xB47F18A0, 0x624FEE80, 0x7614A900, 0xA0245F20, 0x37CDC660, 0xE1FD3040,
+    0x1F7B4960, 0xC94BBF40, 0x5EA22600, 0x8892D020, 0x9CC997A0, 0x4AF96180, 0xDD10F8C0, 0x0B200EE0,
+    0xBDA17560, 0x6B918340, 0xFC781A00, 0x2A48EC20, 0x3E13ABA0, 0xE8235D80, 0x7FCAC4C0, 0xA9FA32E0,
+    0x577C4BC0, 0x814CBDE0, 0x16A524A0, 0xC095D280, 0xD4CE9500, 0x02FE6320, 0x9517FA60, 0x43270C40,
+    0x85A38B00, 0x53937D20, 0xC47AE460, 0x124A1240, 0x061155C0, 0xD021A3E0, 0x47C83AA0, 0x91F8CC80,
+    0x6F7EB5A0, 0xB94E4380, 0x2EA7DAC0, 0xF8972CE0, 0xECCC6B60, 0x3AFC9D40, 0xAD150400, 0x7B25F220
+  },
+  {
+    0x00000000, 0x5B5EE040, 0xB6BDC080, 0xEDE320C0, 0x80C30220, 0xDB9DE260, 0x367EC2A0, 0x6D2022E0,
+    0xEC3E8760, 0xB7606720, 0x5A8347E0, 0x01DDA7A0, 0x6CFD8540, 0x37A36500, 0xDA4045C0, 0x811EA580,
+    0x35C58DE0, 0x6E9B6DA0, 0x83784D60, 0xD826AD20, 0xB5068FC0, 0xEE586F80, 0x03BB4F40, 0x58E5AF00,
+    0xD9FB0A80, 0x82A5EAC0, 0x6F46CA00, 0x34182A40, 0x593808A0, 0x0266E8E0, 0xEF85C820, 0xB4DB2860,
+    0x6B8B1BC0, 0x30D5FB80, 0xDD36DB40, 0x86683B00, 0xEB4819E0, 0xB016F9A0, 0x5DF5D960, 0x06AB3920,
+    0x87B59CA0, 0xDCEB7CE0, 0x31085C20, 0x6A56BC60, 0x07769E80, 0x5C287EC0, 0xB1CB5E00, 0xEA95BE40,
+    0x5E4E9620, 0x05107660, 0xE8F356A0, 0xB3ADB6E0, 0xDE8D9400, 0x85D37440, 0x68305480, 0x336EB4C0,
+    0xB2701140, 0xE92EF100, 0x04CDD1C0, 0x5F933180, 0x32B31360, 0x69EDF320, 0x840ED3E0, 0xDF5033A0,
+    0xD7163780, 0x8C48D7C0, 0x61ABF700, 0x3AF51740, 0x57D535A0, 0x0C8BD5E0, 0xE168F520, 0xBA361560,
+    0x3B28B0E0, 0x607650A0, 0x8D957060, 0xD6CB9020, 0xBBEBB2C0, 0xE0B55280, 0x0D567240, 0x56089200,
+    0xE2D3BA60, 0xB98D5A20, 0x546E7AE0, 0x0F309AA0, 0x6210B840, 0x394E5800, 0xD4AD78C0, 0x8FF39880,
+    0x0EED3D00, 0x55B3DD40, 0xB850FD80, 0xE30E1DC0, 0x8E2E3F20, 0xD570DF60, 0x3893FFA0, 0x63CD1FE0,
+    0xBC9D2C40, 0xE7C3CC00, 0x0A20ECC0, 0x517E0C80, 0x3C5E2E60, 0x6700CE20, 0x8AE3EEE0, 0xD1BD0EA0,
+    0x50A3AB20, 0x0BFD4B60, 0xE61E6BA0, 0xBD408BE0, 0xD060A900, 0x8B3E4940, 0x66DD6980, 0x3D8389C0,
+    0x8958A1A0, 0xD20641E0, 0x3FE56120, 0x64BB8160, 0x099BA380, 0x52C543C0, 0xBF266300, 0xE4788340,
+    0x656626C0, 0x3E38C680, 0xD3DBE640, 0x88850600, 0xE5A524E0, 0xBEFBC4A0, 0x5318E460, 0x08460420,
+    0x4394EC20, 0x18CA0C60, 0xF5292CA0, 0xAE77CCE0, 0xC357EE00, 0x98090E40, 0x75EA2E80, 0x2EB4CEC0,
+    0xAFAA6B40, 0xF4F48B00, 0x1917ABC0, 0x42494B80, 0x2F696960, 0x74378920, 0x99D4A9E0, 0xC28A49A0,
+    0x765161C0, 0x2D0F8180, 0xC0ECA140, 0x9BB24100, 0xF69263E0, 0xADCC83A0, 0x402FA360, 0x1B714320,
+    0x9A6FE6A0, 0xC13106E0, 0x2CD22620, 0x778CC660, 0x1AACE480, 0x41F204C0, 0xAC112400, 0xF74FC440,
+    0x281FF7E0, 0x734117A0, 0x9EA23760, 0xC5FCD720, 0xA8DCF5C0, 0xF3821580, 0x1E613540, 0x453FD500,
+    0xC4217080, 0x9F7F90C0, 0x729CB000, 0x29C25040, 0x44E272A0, 0x1FBC92E0, 0xF25FB220, 0xA9015260,
+    0x1DDA7A00, 0x46849A40, 0xAB67BA80, 0xF0395AC0, 0x9D197820, 0xC6479860, 0x2BA4B8A0, 0x70FA58E0,
+    0xF1E4FD60, 0xAABA1D20, 0x47593DE0, 0x1C07DDA0, 0x7127FF40, 0x2A791F00, 0xC79A3FC0, 0x9CC4DF80,
+    0x9482DBA0, 0xCFDC3BE0, 0x223F1B20, 0x7961FB60, 0x1441D980, 0x4F1F39C0, 0xA2FC1900, 0xF9A2F940,
+    0x78BC5CC0, 0x23E2BC80, 0xCE019C40, 0x955F7C00, 0xF87F5EE0, 0xA321BEA0, 0x4EC29E60, 0x159C7E20,
+    0xA1475640, 0xFA19B600, 0x17FA96C0, 0x4CA47680, 0x21845460, 0x7ADAB420, 0x973994E0, 0xCC6774A0,
+    0x4D79D120, 0x16273160, 0xFBC411A0, 0xA09AF1E0, 0xCDBAD300, 0x96E43340, 0x7B071380, 0x2059F3C0,
+    0xFF09C060, 0xA4572020, 0x49B400E0, 0x12EAE0A0, 0x7FCAC240, 0x24942200, 0xC97702C0, 0x9229E280,
+    0x13374700, 0x4869A740, 0xA58A8780, 0xFED467C0, 0x93F44520, 0xC8AAA560, 0x254985A0, 0x7E1765E0,
+    0xCACC4D80, 0x9192ADC0, 0x7C718D00, 0x272F6D40, 0x4A0F4FA0, 0x1151AFE0, 0xFCB28F20, 0xA7EC6F60,
+    0x26F2CAE0, 0x7DAC2AA0, 0x904F0A60, 0xCB11EA20, 0xA631C8C0, 0xFD6F2880, 0x108C0840, 0x4BD2E800
+  },
+  {
+    0x00000000, 0x8729D840, 0xE3EB33A0, 0x64C2EBE0, 0x2A6EE460, 0xAD473C20, 0xC985D7C0, 0x4EAC0F80,
+    0x54DDC8C0, 0xD3F41080, 0xB736FB60, 0x301F2320, 0x7EB32CA0, 0xF99AF4E0, 0x9D581F00, 0x1A71C740,
+    0xA9BB9180, 0x2E9249C0, 0x4A50A220, 0xCD797A60, 0x83D575E0, 0x04FCADA0, 0x603E4640, 0xE7179E00,
+    0xFD665940, 0x7A4F8100, 0x1E8D6AE0, 0x99A4B2A0, 0xD708BD20, 0x50216560, 0x34E38E80, 0xB3CA56C0,
+    0xBECFA020, 0x39E67860, 0x5D249380, 0xDA0D4BC0, 0x94A14440, 0x13889C00, 0x774A77E0, 0xF063AFA0,
+    0xEA1268E0, 0x6D3BB0A0, 0x09F95B40, 0x8ED08300, 0xC07C8C80, 0x475554C0, 0x2397BF20, 0xA4BE6760,
+    0x177431A0, 0x905DE9E0, 0xF49F0200, 0x73B6DA40, 0x3D1AD5C0, 0xBA330D80, 0xDEF1E660, 0x59D83E20,
+    0x43A9F960, 0xC4802120, 0xA042CAC0, 0x276B1280, 0x69C71D00, 0xEEEEC540, 0x8A2C2EA0, 0x0D05F6E0,
+    0x9027C360, 0x170E1B20, 0x73CCF0C0, 0xF4E52880, 0xBA492700, 0x3D60FF40, 0x59A214A0, 0xDE8BCCE0,
+    0xC4FA0BA0, 0x43D3D3E0, 0x27113800, 0xA038E040, 0xEE94EFC0, 0x69BD3780, 0x0D7FDC60, 0x8A560420,
+    0x399C52E0, 0xBEB58AA0, 0xDA776140, 0x5D5EB900, 0x13F2B680, 0x94DB6EC0, 0xF0198520, 0x77305D60,
+    0x6D419A20, 0xEA684260, 0x8EAAA980, 0x098371C0, 0x472F7E40, 0xC006A600, 0xA4C44DE0, 0x23ED95A0,
+    0x2EE86340, 0xA9C1BB00, 0xCD0350E0, 0x4A2A88A0, 0x04868720, 0x83AF5F60, 0xE76DB480, 0x60446CC0,
+    0x7A35AB80, 0xFD1C73C0, 0x99DE9820, 0x1EF74060, 0x505B4FE0, 0xD77297A0, 0xB3B07C40, 0x3499A400,
+    0x8753F2C0, 0x007A2A80, 0x64B8C160, 0xE3911920, 0xAD3D16A0, 0x2A14CEE0, 0x4ED62500, 0xC9FFFD40,
+    0xD38E3A00, 0x54A7E240, 0x306509A0, 0xB74CD1E0, 0xF9E0DE60, 0x7EC90620, 0x1A0BEDC0, 0x9D223580,
+    0xCDF705E0, 0x4ADEDDA0, 0x2E1C3640, 0xA935EE00, 0xE799E180, 0x60B039C0, 0x0472D220, 0x835B0A60,
+    0x992ACD20, 0x1E031560, 0x7AC1FE80, 0xFDE826C0, 0xB3442940, 0x346DF100, 0x50AF1AE0, 0xD786C2A0,
+    0x644C9460, 0xE3654C20, 0x87A7A7C0, 0x008E7F80, 0x4E227000, 0xC90BA840, 0xADC943A0, 0x2AE09BE0,
+    0x30915CA0, 0xB7B884E0, 0xD37A6F00, 0x5453B740, 0x1AFFB8C0, 0x9DD66080, 0xF9148B60, 0x7E3D5320,
+    0x7338A5C0, 0xF4117D80, 0x90D39660, 0x17FA4E20, 0x595641A0, 0xDE7F99E0, 0xBABD7200, 0x3D94AA40,
+    0x27E56D00, 0xA0CCB540, 0xC40E5EA0, 0x432786E0, 0x0D8B8960, 0x8AA25120, 0xEE60BAC0, 0x69496280,
+    0xDA833440, 0x5DAAEC00, 0x396807E0, 0xBE41DFA0, 0xF0EDD020, 0x77C40860, 0x1306E380, 0x942F3BC0,
+    0x8E5EFC80, 0x097724C0, 0x6DB5CF20, 0xEA9C1760, 0xA43018E0, 0x2319C0A0, 0x47DB2B40, 0xC0F2F300,
+    0x5DD0C680, 0xDAF91EC0, 0xBE3BF520, 0x39122D60, 0x77BE22E0, 0xF097FAA0, 0x94551140, 0x137CC900,
+    0x090D0E40, 0x8E24D600, 0xEAE63DE0, 0x6DCFE5A0, 0x2363EA20, 0xA44A3260, 0xC088D980, 0x47A101C0,
+    0xF46B5700, 0x73428F40, 0x178064A0, 0x90A9BCE0, 0xDE05B360, 0x592C6B20, 0x3DEE80C0, 0xBAC75880,
+    0xA0B69FC0, 0x279F4780, 0x435DAC60, 0xC4747420, 0x8AD87BA0, 0x0DF1A3E0, 0x69334800, 0xEE1A9040,
+    0xE31F66A0, 0x6436BEE0, 0x00F45500, 0x87DD8D40, 0xC97182C0, 0x4E585A80, 0x2A9AB160, 0xADB36920,
+    0xB7C2AE60, 0x30EB7620, 0x54299DC0, 0xD3004580, 0x9DAC4A00, 0x1A859240, 0x7E4779A0, 0xF96EA1E0,
+    0x4AA4F720, 0xCD8D2F60, 0xA94FC480, 0x2E661CC0, 0x60CA1340, 0xE7E3CB00, 0x832120E0, 0x0408F8A0,
+    0x1E793FE0, 0x9950E7A0, 0xFD920C40, 0x7ABBD400, 0x3417DB80, 0xB33E03C0, 0xD7FCE820, 0x50D53060
+  },
+#endif
+};
+#endif
+
+#ifdef CRC_CLMUL_ENABLED
+static const ClmulConstants_T Crc16ClmulConstants =
+{
+  .fold128 = {0xD5480000, 0xA9A80000},
+  .fold512 = {0x8C280000, 0x39E00000},
+};
+
+static const ClmulConstants_T Crc32ClmulConstants =
+{
+  .fold128 = {0x488F7CC0, 0x2E058D00},
+  .fold512 = {0xE24F14C0, 0x1B5F3A20},
+};
+#endif
 
 /*======================================================================================*/
 /*                    ####### LOCAL FUNCTIONS PROTOTYPES #######                        */
 /*======================================================================================*/
+static uint8_t UpdateCrc8(uint8_t remainder, uint8_t const *data, size_t nBytes);
+static uint16_t UpdateCrc16(uint16_t remainder, uint8_t const *data, size_t nBytes);
+static uint32_t UpdateCrc32(uint32_t remainder, uint8_t const *data, size_t nBytes);
+#ifdef CRC32_SLICING_ENABLED
+static inline uint32_t StepCrc32Slicing8(uint32_t remainder, uint8_t const *data);
+static uint32_t UpdateCrc32Slicing8(uint32_t remainder, uint8_t const *data, size_t nBlocks);
+#if CRC32_SLICING == 16
+static uint32_t UpdateCrc32Slicing16(uint32_t remainder, uint8_t const *data, size_t nBlocks);
+#endif
+#endif
+static uint32_t UpdateCrc32c(uint32_t remainder, uint8_t const *data, size_t nBytes);
+static uint32_t MultModPoly(uint32_t a, uint32_t b, uint8_t width, uint32_t polynomial);
+static uint32_t ShiftCrc(uint32_t remainder, size_t nBytes, uint8_t width, uint32_t polynomial);
+static uint32_t ReflectBits32(uint32_t value);
+static uint32_t ShiftRemainder(CRC_CalcSize_T crcSize, uint32_t remainder, size_t nBytes);
+static void CalcBatchGroup(CRC_CalcSize_T crcSize, uint8_t const * const data[], size_t const nBytes[], uint32_t crc[],
+                           uint8_t nLanes);
+static size_t UpdateLanes(CRC_CalcSize_T crcSize, uint32_t remainder[CRC_BATCH_LANES], uint8_t const * const data[],
+                          size_t nBytes);
+#ifdef CRC_SSE42_ENABLED
+static inline uint64_t LoadUint64(uint8_t const *bytes);
+static inline uint32_t UpdateCrc32cHw(uint32_t remainder, uint8_t const *data, size_t nBytes, bool isClmulUsed);
+static uint32_t UpdateCrc32cSse42(uint32_t remainder, uint8_t const *data, size_t nBytes);
+static uint32_t UpdateCrc32cSse42Clmul(uint32_t remainder, uint8_t const *data, size_t nBytes);
+static uint32_t UpdateCrc32cThreeStreams(uint32_t remainder, uint8_t const *data, size_t nBytes, size_t blockSize,
+                                         uint32_t shiftBlock, uint32_t shift2Blocks);
+static size_t UpdateCrc32cLanesSse42(uint32_t remainder[CRC_BATCH_LANES], uint8_t const * const data[], size_t nBytes);
+static void CopyStreaming(uint8_t *dst, uint8_t const *src, size_t nBytes);
+#endif
+#ifdef CRC_CLMUL_ENABLED
+static size_t FoldClmul(uint8_t folded[16], uint32_t remainder, uint8_t const *data, size_t nBytes,
+                        ClmulConstants_T const *constants);
+#endif
+#ifdef CPUF_RESOLVER
+static void ResolveKernels(void);
+#endif
 
 /*======================================================================================*/
 /*                  ####### EXPORTED FUNCTIONS DEFINITIONS #######                      */
 /*======================================================================================*/
-uint8_t  CRC_CalcCRC8(uint8_t *data, uint16_t nBytes)
+uint8_t  CRC_CalcCRC8(uint8_t const *data, size_t nBytes)
+{
+  return (UpdateCrc8(CRC8_INITIAL_VALUE, data, nBytes) ^ CRC8_FINAL_XOR_VALUE);
+}
+
+uint16_t CRC_CalcCRC16(uint8_t const *data, size_t nBytes)
+{
+  return (UpdateCrc16(CRC16_INITIAL_VALUE, data, nBytes) ^ CRC16_FINAL_XOR_VALUE);
+}
+
+uint32_t CRC_CalcCRC32(uint8_t const *data, size_t nBytes)
+{
+  return (UpdateCrc32(CRC32_INITIAL_VALUE, data, nBytes) ^ CRC32_FINAL_XOR_VALUE);
+}
+
+uint32_t CRC_CalcCRC32C(uint8_t const *data, size_t nBytes)
+{
+  return (UpdateCrc32c(CRC32C_INITIAL_VALUE, data, nBytes) ^ CRC32C_FINAL_XOR_VALUE);
+}
+
+void CRC_CalcIterateStart(CRC_CalcSize_T crcSize)
+{
+  CRC_CtxInit(&IterateCtx, crcSize);
+}
+
+uint32_t CRC_CalcIterate(uint8_t byte, CRC_CalcSize_T crcSize)
+{
+  IterateCtx.crcSize = crcSize;
+  CRC_CtxUpdate(&IterateCtx, &byte, 1);
+
+  return CRC_CtxFinal(&IterateCtx);
+}
+
+void CRC_CtxInit(CRC_Ctx_T * const ctx, CRC_CalcSize_T crcSize)
+{
+  ctx->crcSize = crcSize;
+
+  switch(crcSize)
+  {
+    case CRC_CALC_SIZE_8:
+    default:
+    {
+      ctx->remainder = CRC8_INITIAL_VALUE;
+      break;
+    }
+    case CRC_CALC_SIZE_16:
+    {
+      ctx->remainder = CRC16_INITIAL_VALUE;
+      break;
+    }
+    case CRC_CALC_SIZE_32:
+    {
+      ctx->remainder = CRC32_INITIAL_VALUE;
+      break;
+    }
+    case CRC_CALC_SIZE_32C:
+    {
+      ctx->remainder = CRC32C_INITIAL_VALUE;
+      break;
+    }
+  }
+}
+
+void CRC_CtxUpdate(CRC_Ctx_T * const ctx, void const * const data, size_t nBytes)
+{
+  switch(ctx->crcSize)
+  {
+    case CRC_CALC_SIZE_8:
+    default:
+    {
+      ctx->remainder = UpdateCrc8((uint8_t)ctx->remainder, (uint8_t const*)data, nBytes);
+      break;
+    }
+    case CRC_CALC_SIZE_16:
+    {
+      ctx->remainder = UpdateCrc16((uint16_t)ctx->remainder, (uint8_t const*)data, nBytes);
+      break;
+    }
+    case CRC_CALC_SIZE_32:
+    {
+      ctx->remainder = UpdateCrc32(ctx->remainder, (uint8_t const*)data, nBytes);
+      break;
+    }
+    case CRC_CALC_SIZE_32C:
+    {
+      ctx->remainder = UpdateCrc32c(ctx->remainder, (uint8_t const*)data, nBytes);
+      break;
+    }
+  }
+}
+
+void CRC_CtxUpdateSegments(CRC_Ctx_T * const ctx, CRC_Segment_T const segments[], size_t nSegments)
+{
+  for (size_t segment = 0; segment < nSegments; segment++)
+  {
+    CRC_CtxUpdate(ctx, segments[segment].pData, segments[segment].nBytes);
+  }
+}
+
+uint32_t CRC_CtxFinal(CRC_Ctx_T const * const ctx)
+{
+  switch(ctx->crcSize)
+  {
+    case CRC_CALC_SIZE_8:
+    default:
+    {
+      return (uint8_t)(ctx->remainder ^ CRC8_FINAL_XOR_VALUE);
+    }
+    case CRC_CALC_SIZE_16:
+    {
+      return (uint16_t)(ctx->remainder ^ CRC16_FINAL_XOR_VALUE);
+    }
+    case CRC_CALC_SIZE_32:
+    {
+      return (uint32_t)(ctx->remainder ^ CRC32_FINAL_XOR_VALUE);
+    }
+    case CRC_CALC_SIZE_32C:
+    {
+      return (uint32_t)(ctx->remainder ^ CRC32C_FINAL_XOR_VALUE);
+    }
+  }
+}
+
+uint8_t CRC_CalcSegmentsCRC8(CRC_Segment_T const segments[], size_t nSegments)
+{
+  CRC_Ctx_T ctx;
+
+  CRC_CtxInit(&ctx, CRC_CALC_SIZE_8);
+  CRC_CtxUpdateSegments(&ctx, segments, nSegments);
+
+  return (uint8_t)CRC_CtxFinal(&ctx);
+}
+
+uint16_t CRC_CalcSegmentsCRC16(CRC_Segment_T const segments[], size_t nSegments)
+{
+  CRC_Ctx_T ctx;
+
+  CRC_CtxInit(&ctx, CRC_CALC_SIZE_16);
+  CRC_CtxUpdateSegments(&ctx, segments, nSegments);
+
+  return (uint16_t)CRC_CtxFinal(&ctx);
+}
+
+uint32_t CRC_CalcSegmentsCRC32(CRC_Segment_T const segments[], size_t nSegments)
+{
+  CRC_Ctx_T ctx;
+
+  CRC_CtxInit(&ctx, CRC_CALC_SIZE_32);
+  CRC_CtxUpdateSegments(&ctx, segments, nSegments);
+
+  return CRC_CtxFinal(&ctx);
+}
+
+uint32_t CRC_CalcSegmentsCRC32C(CRC_Segment_T const segments[], size_t nSegments)
+{
+  CRC_Ctx_T ctx;
+
+  CRC_CtxInit(&ctx, CRC_CALC_SIZE_32C);
+  CRC_CtxUpdateSegments(&ctx, segments, nSegments);
+
+  return CRC_CtxFinal(&ctx);
+}
+
+void CRC_CtxCopyAndUpdate(CRC_Ctx_T * const ctx, void * const dst, void const * const src, size_t nBytes)
 {
-  uint8_t remainder = CRC8_INITIAL_VALUE;
+  uint8_t *dstBytes = (uint8_t*)dst;
+  uint8_t const *srcBytes = (uint8_t const*)src;
+
+#ifdef CRC_SSE42_ENABLED
+  bool isStreaming = (nBytes >= CRC_COPY_STREAMING_THRESHOLD);
+#endif
 
-  for (uint16_t byte = 0; byte < nBytes; byte++)
+  while (nBytes > 0)
   {
+    size_t nBlockBytes = (nBytes < CRC_COPY_BLOCK_SIZE) ? nBytes : CRC_COPY_BLOCK_SIZE;
+
+#ifdef CRC_SSE42_ENABLED
+    if (true == isStreaming)
+    {
+      CopyStreaming(dstBytes, srcBytes, nBlockBytes);
+    }
+    else
+#endif
+    {
+      memcpy(dstBytes, srcBytes, nBlockBytes);
+    }
+    CRC_CtxUpdate(ctx, srcBytes, nBlockBytes);
+
+    dstBytes += nBlockBytes;
+    srcBytes += nBlockBytes;
+    nBytes -= nBlockBytes;
+  }
+
+#ifdef CRC_SSE42_ENABLED
+  if (true == isStreaming)
+  {
+    _mm_sfence();
+  }
+#endif
+}
+
+uint8_t CRC_CopyAndCalcCRC8(uint8_t *dst, uint8_t const *src, size_t nBytes)
+{
+  CRC_Ctx_T ctx;
+
+  CRC_CtxInit(&ctx, CRC_CALC_SIZE_8);
+  CRC_CtxCopyAndUpdate(&ctx, dst, src, nBytes);
+
+  return (uint8_t)CRC_CtxFinal(&ctx);
+}
+
+uint16_t CRC_CopyAndCalcCRC16(uint8_t *dst, uint8_t const *src, size_t nBytes)
+{
+  CRC_Ctx_T ctx;
+
+  CRC_CtxInit(&ctx, CRC_CALC_SIZE_16);
+  CRC_CtxCopyAndUpdate(&ctx, dst, src, nBytes);
+
+  return (uint16_t)CRC_CtxFinal(&ctx);
+}
+
+uint32_t CRC_CopyAndCalcCRC32(uint8_t *dst, uint8_t const *src, size_t nBytes)
+{
+  CRC_Ctx_T ctx;
+
+  CRC_CtxInit(&ctx, CRC_CALC_SIZE_32);
+  CRC_CtxCopyAndUpdate(&ctx, dst, src, nBytes);
+
+  return CRC_CtxFinal(&ctx);
+}
+
+uint32_t CRC_CopyAndCalcCRC32C(uint8_t *dst, uint8_t const *src, size_t nBytes)
+{
+  CRC_Ctx_T ctx;
+
+  CRC_CtxInit(&ctx, CRC_CALC_SIZE_32C);
+  CRC_CtxCopyAndUpdate(&ctx, dst, src, nBytes);
+
+  return CRC_CtxFinal(&ctx);
+}
+
+uint32_t CRC_Combine(CRC_CalcSize_T crcSize, uint32_t crcA, uint32_t crcB, size_t nBytesB)
+{
+  CRC_Ctx_T ctx;
+
+  /* Final CRC of empty data is initial value XOR final value, CRC of B already contains both of them */
+  CRC_CtxInit(&ctx, crcSize);
+  crcA ^= CRC_CtxFinal(&ctx);
+
+  return (ShiftRemainder(crcSize, crcA, nBytesB) ^ crcB);
+}
+
+uint8_t CRC_CombineCRC8(uint8_t crcA, uint8_t crcB, size_t nBytesB)
+{
+  return (uint8_t)CRC_Combine(CRC_CALC_SIZE_8, crcA, crcB, nBytesB);
+}
+
+uint16_t CRC_CombineCRC16(uint16_t crcA, uint16_t crcB, size_t nBytesB)
+{
+  return (uint16_t)CRC_Combine(CRC_CALC_SIZE_16, crcA, crcB, nBytesB);
+}
+
+uint32_t CRC_CombineCRC32(uint32_t crcA, uint32_t crcB, size_t nBytesB)
+{
+  return CRC_Combine(CRC_CALC_SIZE_32, crcA, crcB, nBytesB);
+}
+
+uint32_t CRC_CombineCRC32C(uint32_t crcA, uint32_t crcB, size_t nBytesB)
+{
+  return CRC_Combine(CRC_CALC_SIZE_32C, crcA, crcB, nBytesB);
+}
+
+uint32_t CRC_Patch(CRC_CalcSize_T crcSize, uint32_t crc, size_t dataSize, size_t offset, void const * const oldBytes,
+                   void const * const newBytes, size_t nBytes)
+{
+  uint8_t const *oldData = (uint8_t const*)oldBytes;
+  uint8_t const *newData = (uint8_t const*)newBytes;
+  uint8_t difference[CRC_PATCH_BLOCK_SIZE];
+  CRC_Ctx_T ctx;
+
+  /* Written as two comparisons, offset + nBytes could wrap around */
+  if ( (offset > dataSize) || (nBytes > dataSize - offset) )
+  {
+    return crc;
+  }
+
+  /* CRC is affine, CRC of changed data differs by CRC of the difference calculated without initial and final XOR */
+  ctx.crcSize = crcSize;
+  ctx.remainder = 0;
+
+  for (size_t byte = 0; byte < nBytes; byte += sizeof(difference))
+  {
+    size_t nBlockBytes = (nBytes - byte < sizeof(difference)) ? (nBytes - byte) : sizeof(difference);
+
+    for (size_t idx = 0; idx < nBlockBytes; idx++)
+    {
+      difference[idx] = oldData[byte + idx] ^ newData[byte + idx];
+    }
+
+    CRC_CtxUpdate(&ctx, difference, nBlockBytes);
+  }
+
+  return (crc ^ ShiftRemainder(crcSize, ctx.remainder, dataSize - offset - nBytes));
+}
+
+uint8_t CRC_PatchCRC8(uint8_t crc, size_t dataSize, size_t offset, void const * const oldBytes,
+                      void const * const newBytes, size_t nBytes)
+{
+  return (uint8_t)CRC_Patch(CRC_CALC_SIZE_8, crc, dataSize, offset, oldBytes, newBytes, nBytes);
+}
+
+uint16_t CRC_PatchCRC16(uint16_t crc, size_t dataSize, size_t offset, void const * const oldBytes,
+                        void const * const newBytes, size_t nBytes)
+{
+  return (uint16_t)CRC_Patch(CRC_CALC_SIZE_16, crc, dataSize, offset, oldBytes, newBytes, nBytes);
+}
+
+uint32_t CRC_PatchCRC32(uint32_t crc, size_t dataSize, size_t offset, void const * const oldBytes,
+                        void const * const newBytes, size_t nBytes)
+{
+  return CRC_Patch(CRC_CALC_SIZE_32, crc, dataSize, offset, oldBytes, newBytes, nBytes);
+}
+
+uint32_t CRC_PatchCRC32C(uint32_t crc, size_t dataSize, size_t offset, void const * const oldBytes,
+                         void const * const newBytes, size_t nBytes)
+{
+  return CRC_Patch(CRC_CALC_SIZE_32C, crc, dataSize, offset, oldBytes, newBytes, nBytes);
+}
+
+void CRC_CalcBatch(CRC_CalcSize_T crcSize, uint8_t const * const data[], size_t const nBytes[], uint32_t crc[],
+                   size_t nBuffers)
+{
+  size_t buffer = 0;
+
+  for (; buffer + CRC_BATCH_LANES <= nBuffers; buffer += CRC_BATCH_LANES)
+  {
+    CalcBatchGroup(crcSize, &data[buffer], &nBytes[buffer], &crc[buffer], CRC_BATCH_LANES);
+  }
+
+  for (; buffer < nBuffers; buffer++)
+  {
+    CalcBatchGroup(crcSize, &data[buffer], &nBytes[buffer], &crc[buffer], 1);
+  }
+}
+
+/*======================================================================================*/
+/*                   ####### LOCAL FUNCTIONS DEFINITIONS #######                        */
+/*======================================================================================*/
+static uint8_t UpdateCrc8(uint8_t remainder, uint8_t const *data, size_t nBytes)
+{
+  for (size_t byte = 0; byte < nBytes; byte++)
+  {
+#if CRC_CALC_METHOD == CRC_CALC_METHOD_TABLE
+    remainder = Crc8Table[remainder ^ data[byte]];
+#elif CRC_CALC_METHOD == CRC_CALC_METHOD_NIBBLE
+    remainder ^= CRC8_BYTE_TO_REMAINDER(data[byte]);
+    remainder = (remainder << 4) ^ Crc8NibbleTable[remainder >> 4];
+    remainder = (remainder << 4) ^ Crc8NibbleTable[remainder >> 4];
+#else
     remainder ^= CRC8_BYTE_TO_REMAINDER(data[byte]);
 
     for (uint8_t nBit = 0; nBit < 8; nBit++)
@@ -84,17 +1244,35 @@ uint8_t  CRC_CalcCRC8(uint8_t *data, uint16_t nBytes)
         remainder = (remainder << 1);
       }
     }
+#endif
   }
 
-  return (remainder ^ CRC8_FINAL_XOR_VALUE);
+  return remainder;
 }
 
-uint16_t CRC_CalcCRC16(uint8_t *data, uint16_t nBytes)
+static uint16_t UpdateCrc16(uint16_t remainder, uint8_t const *data, size_t nBytes)
 {
-  uint16_t remainder = CRC16_INITIAL_VALUE;
+#ifdef CRC_CLMUL_ENABLED
+  if ( (nBytes >= CRC_CLMUL_THRESHOLD) && (NULL != Kernels.foldClmul) )
+  {
+    uint8_t folded[16];
+    size_t nFoldedBytes = Kernels.foldClmul(folded, (uint32_t)remainder << 16, data, nBytes, &Crc16ClmulConstants);
+
+    remainder = UpdateCrc16(0, folded, sizeof(folded));
+    data += nFoldedBytes;
+    nBytes -= nFoldedBytes;
+  }
+#endif
 
-  for (uint16_t byte = 0; byte < nBytes; byte++)
+  for (size_t byte = 0; byte < nBytes; byte++)
   {
+#if CRC_CALC_METHOD == CRC_CALC_METHOD_TABLE
+    remainder = (remainder << 8) ^ Crc16Table[(remainder >> 8) ^ data[byte]];
+#elif CRC_CALC_METHOD == CRC_CALC_METHOD_NIBBLE
+    remainder ^= CRC16_BYTE_TO_REMAINDER(data[byte]);
+    remainder = (remainder << 4) ^ Crc16NibbleTable[remainder >> 12];
+    remainder = (remainder << 4) ^ Crc16NibbleTable[remainder >> 12];
+#else
     remainder ^= CRC16_BYTE_TO_REMAINDER(data[byte]);
 
     for (uint8_t nBit = 0; nBit < 8; nBit++)
@@ -108,18 +1286,54 @@ uint16_t CRC_CalcCRC16(uint8_t *data, uint16_t nBytes)
         remainder = (remainder << 1);
       }
     }
+#endif
   }
 
-  return (remainder ^ CRC16_FINAL_XOR_VALUE);
+  return remainder;
 }
 
-uint32_t CRC_CalcCRC32(uint8_t *data, uint16_t nBytes)
+static uint32_t UpdateCrc32(uint32_t remainder, uint8_t const *data, size_t nBytes)
 {
-  uint32_t remainder = CRC32_INITIAL_VALUE;
+#ifdef CRC_CLMUL_ENABLED
+  if ( (nBytes >= CRC_CLMUL_THRESHOLD) && (NULL != Kernels.foldClmul) )
+  {
+    uint8_t folded[16];
+    size_t nFoldedBytes = Kernels.foldClmul(folded, remainder, data, nBytes, &Crc32ClmulConstants);
+
+    remainder = UpdateCrc32(0, folded, sizeof(folded));
+    data += nFoldedBytes;
+    nBytes -= nFoldedBytes;
+  }
+#endif
 
-  for (uint16_t byte = 0; byte < nBytes; byte++)
+#ifdef CRC32_SLICING_ENABLED
+  if (nBytes >= CRC32_SLICING_8_THRESHOLD)
   {
-    remainder ^= CRC32_BYTE_TO_REMAINDER(data[byte]);
+#if CRC32_SLICING == 16
+    if (nBytes >= CRC32_SLICING_16_THRESHOLD)
+    {
+      remainder = UpdateCrc32Slicing16(remainder, data, nBytes / 16);
+      data += nBytes & ~(size_t)15;
+      nBytes &= 15;
+    }
+#endif
+
+    remainder = UpdateCrc32Slicing8(remainder, data, nBytes / 8);
+    data += nBytes & ~(size_t)7;
+    nBytes &= 7;
+  }
+#endif
+
+  for (size_t byte = 0; byte < nBytes; byte++)
+  {
+#if CRC_CALC_METHOD == CRC_CALC_METHOD_TABLE
+    remainder = (remainder << 8) ^ Crc32Table[(remainder >> 24) ^ data[byte]];
+#elif CRC_CALC_METHOD == CRC_CALC_METHOD_NIBBLE
+    remainder ^= CRC32_BYTE_TO_REMAINDER((uint32_t)data[byte]);
+    remainder = (remainder << 4) ^ Crc32NibbleTable[remainder >> 28];
+    remainder = (remainder << 4) ^ Crc32NibbleTable[remainder >> 28];
+#else
+    remainder ^= CRC32_BYTE_TO_REMAINDER((uint32_t)data[byte]);
 
     for (uint8_t nBit = 0; nBit < 8; nBit++)
     {
@@ -132,100 +1346,595 @@ uint32_t CRC_CalcCRC32(uint8_t *data, uint16_t nBytes)
         remainder = (remainder << 1);
       }
     }
+#endif
   }
 
-  return (remainder ^ CRC32_FINAL_XOR_VALUE);
+  return remainder;
 }
 
-void CRC_CalcIterateStart(CRC_CalcSize_T crcSize)
+static uint32_t UpdateCrc32c(uint32_t remainder, uint8_t const *data, size_t nBytes)
 {
-  switch(crcSize)
+  if (NULL != Kernels.updateCrc32c)
   {
-    case CRC_CALC_SIZE_8:
-    default:
+    return Kernels.updateCrc32c(remainder, data, nBytes);
+  }
+
+  for (size_t byte = 0; byte < nBytes; byte++)
+  {
+#if CRC_CALC_METHOD == CRC_CALC_METHOD_TABLE
+    remainder = (remainder >> 8) ^ Crc32cTable[(remainder ^ data[byte]) & 0xFF];
+#elif CRC_CALC_METHOD == CRC_CALC_METHOD_NIBBLE
+    remainder ^= data[byte];
+    remainder = (remainder >> 4) ^ Crc32cNibbleTable[remainder & 0x0F];
+    remainder = (remainder >> 4) ^ Crc32cNibbleTable[remainder & 0x0F];
+#else
+    remainder ^= data[byte];
+
+    for (uint8_t nBit = 0; nBit < 8; nBit++)
     {
-      Remainder = CRC8_INITIAL_VALUE;
-      break;
+      if (remainder & 1)
+      {
+        remainder = (remainder >> 1) ^ CRC32C_POLYNOMIAL;
+      }
+      else
+      {
+        remainder = (remainder >> 1);
+      }
     }
-    case CRC_CALC_SIZE_16:
+#endif
+  }
+
+  return remainder;
+}
+
+/**
+ * @brief   Multiplies two polynomials modulo CRC polynomial P, MSB first representation.
+ * @param   [in] a          is first factor, polynomial of degree lower than width
+ * @param   [in] b          is second factor, polynomial of degree lower than width
+ * @param   [in] width      is CRC width in bits
+ * @param   [in] polynomial is CRC polynomial without the x^width term
+ * @return  a * b mod P.
+ */
+static uint32_t MultModPoly(uint32_t a, uint32_t b, uint8_t width, uint32_t polynomial)
+{
+  uint32_t msBit = (uint32_t)1 << (width - 1);
+  uint32_t product = 0;
+
+  for (uint8_t bit = width; bit > 0; bit--)
+  {
+    if (product & msBit)
     {
-      Remainder = CRC16_INITIAL_VALUE;
-      break;
+      product = ((product << 1) ^ polynomial) & ((msBit << 1) - 1);
     }
-    case CRC_CALC_SIZE_32:
+    else
     {
-      Remainder = CRC32_INITIAL_VALUE;
-      break;
+      product = (product << 1);
+    }
+
+    if ((a >> (bit - 1)) & 1)
+    {
+      product ^= b;
     }
   }
+
+  return product;
 }
 
-uint32_t CRC_CalcIterate(uint8_t byte, CRC_CalcSize_T crcSize)
+/**
+ * @brief   Calculates remainder after processing given number of zero bytes, in O(log(nBytes)) time.
+ * @param   [in] remainder  is remainder in MSB first representation
+ * @param   [in] nBytes     is number of zero bytes
+ * @param   [in] width      is CRC width in bits
+ * @param   [in] polynomial is CRC polynomial without the x^width term
+ * @return  remainder * x^(8 * nBytes) mod P.
+ */
+static uint32_t ShiftCrc(uint32_t remainder, size_t nBytes, uint8_t width, uint32_t polynomial)
 {
-  uint32_t msBit, polynomial, finalXorValue;
+  uint32_t square = MultModPoly((uint32_t)1 << 7, (uint32_t)1 << 1, width, polynomial);
 
+  for (; nBytes > 0; nBytes >>= 1)
+  {
+    if (nBytes & 1)
+    {
+      remainder = MultModPoly(remainder, square, width, polynomial);
+    }
+
+    square = MultModPoly(square, square, width, polynomial);
+  }
+
+  return remainder;
+}
+
+static uint32_t ReflectBits32(uint32_t value)
+{
+  value = ((value >> 1) & 0x55555555) | ((value & 0x55555555) << 1);
+  value = ((value >> 2) & 0x33333333) | ((value & 0x33333333) << 2);
+  value = ((value >> 4) & 0x0F0F0F0F) | ((value & 0x0F0F0F0F) << 4);
+  value = ((value >> 8) & 0x00FF00FF) | ((value & 0x00FF00FF) << 8);
+
+  return ((value >> 16) | (value << 16));
+}
+
+/**
+ * @brief   Calculates remainder after processing given number of zero bytes, in representation used by context.
+ * @param   [in] crcSize    is size of the CRC
+ * @param   [in] remainder  is remainder
+ * @param   [in] nBytes     is number of zero bytes
+ * @return  Shifted remainder.
+ */
+static uint32_t ShiftRemainder(CRC_CalcSize_T crcSize, uint32_t remainder, size_t nBytes)
+{
   switch(crcSize)
   {
     case CRC_CALC_SIZE_8:
     default:
     {
-      Remainder ^= CRC8_BYTE_TO_REMAINDER(byte);
-      msBit = CRC8_MSBIT;
-      polynomial = CRC8_POLYNOMIAL;
-      finalXorValue = CRC8_FINAL_XOR_VALUE;
-      break;
+      return ShiftCrc((uint8_t)remainder, nBytes, 8, CRC8_POLYNOMIAL);
     }
     case CRC_CALC_SIZE_16:
     {
-      Remainder ^= CRC16_BYTE_TO_REMAINDER(byte);
-      msBit = CRC16_MSBIT;
-      polynomial = CRC16_POLYNOMIAL;
-      finalXorValue = CRC16_FINAL_XOR_VALUE;
-      break;
+      return ShiftCrc((uint16_t)remainder, nBytes, 16, CRC16_POLYNOMIAL);
     }
     case CRC_CALC_SIZE_32:
     {
-      Remainder ^= CRC32_BYTE_TO_REMAINDER(byte);
-      msBit = CRC32_MSBIT;
-      polynomial = CRC32_POLYNOMIAL;
-      finalXorValue = CRC32_FINAL_XOR_VALUE;
-      break;
+      return ShiftCrc(remainder, nBytes, 32, CRC32_POLYNOMIAL);
+    }
+    case CRC_CALC_SIZE_32C:
+    {
+      /* CRC-32C remainder is reflected */
+      return ReflectBits32(ShiftCrc(ReflectBits32(remainder), nBytes, 32, CRC32C_POLYNOMIAL_MSB_FIRST));
     }
   }
+}
 
-  for (uint8_t nBit = 0; nBit < 8; nBit++)
+/**
+ * @brief   Calculates CRCs of a group of buffers.
+ *
+ *          Length common to all buffers is processed by interleaved lanes, the rest of each buffer
+ *          by the single buffer algorithm.
+ * @param   [in] crcSize    is size of calculated CRCs
+ * @param   [in] data       is array of pointers to buffers
+ * @param   [in] nBytes     is array of buffers lengths in bytes
+ * @param   [out] crc       is array of calculated CRCs
+ * @param   [in] nLanes     is number of buffers in the group, 1 or #CRC_BATCH_LANES
+ */
+static void CalcBatchGroup(CRC_CalcSize_T crcSize, uint8_t const * const data[], size_t const nBytes[], uint32_t crc[],
+                           uint8_t nLanes)
+{
+  uint32_t remainder[CRC_BATCH_LANES];
+  size_t nCommonBytes = nBytes[0];
+  size_t nInterleavedBytes = 0;
+  CRC_Ctx_T ctx;
+
+  CRC_CtxInit(&ctx, crcSize);
+
+  for (uint8_t lane = 0; lane < nLanes; lane++)
   {
-    if (Remainder & msBit)
+    remainder[lane] = ctx.remainder;
+
+    if (nBytes[lane] < nCommonBytes)
     {
-      Remainder = (Remainder << 1) ^ polynomial;
+      nCommonBytes = nBytes[lane];
     }
-    else
+  }
+
+  if (nLanes > 1)
+  {
+    nInterleavedBytes = UpdateLanes(crcSize, remainder, data, nCommonBytes);
+  }
+
+  for (uint8_t lane = 0; lane < nLanes; lane++)
+  {
+    ctx.remainder = remainder[lane];
+
+    if (nBytes[lane] > nInterleavedBytes)
     {
-      Remainder = (Remainder << 1);
+      CRC_CtxUpdate(&ctx, &data[lane][nInterleavedBytes], nBytes[lane] - nInterleavedBytes);
     }
+
+    crc[lane] = CRC_CtxFinal(&ctx);
   }
+}
+
+/**
+ * @brief   Updates remainders of #CRC_BATCH_LANES buffers with their common length, lanes are interleaved.
+ * @param   [in] crcSize        is size of calculated CRCs
+ * @param   [in,out] remainder  is array of remainders
+ * @param   [in] data           is array of pointers to buffers
+ * @param   [in] nBytes         is length common to all buffers
+ * @return  Number of processed bytes of each buffer, the rest is left for the single buffer algorithm.
+ */
+static size_t UpdateLanes(CRC_CalcSize_T crcSize, uint32_t remainder[CRC_BATCH_LANES], uint8_t const * const data[],
+                          size_t nBytes)
+{
+  if ( (CRC_CALC_SIZE_32C == crcSize) && (NULL != Kernels.updateCrc32cLanes) )
+  {
+    return Kernels.updateCrc32cLanes(remainder, data, nBytes);
+  }
+
+#if CRC_CALC_METHOD == CRC_CALC_METHOD_TABLE
+  uint32_t lanes[CRC_BATCH_LANES];
+  size_t byte = 0;
+
+#ifdef CRC_CLMUL_ENABLED
+  /* Long buffers are processed faster by folding one at a time */
+  if ( (CRC_CALC_SIZE_16 == crcSize || CRC_CALC_SIZE_32 == crcSize) && (nBytes >= CRC_CLMUL_THRESHOLD)
+      && (NULL != Kernels.foldClmul) )
+  {
+    return 0;
+  }
+#endif
+
+  memcpy(lanes, remainder, sizeof(lanes));
 
   switch(crcSize)
   {
     case CRC_CALC_SIZE_8:
     default:
     {
-      return (uint8_t)(Remainder ^ finalXorValue);
+      for (; byte < nBytes; byte++)
+      {
+        CRC_UNROLL_LANES
+        for (uint8_t lane = 0; lane < CRC_BATCH_LANES; lane++)
+        {
+          lanes[lane] = Crc8Table[lanes[lane] ^ data[lane][byte]];
+        }
+      }
+      break;
     }
     case CRC_CALC_SIZE_16:
     {
-      return (uint16_t)(Remainder ^ finalXorValue);
+      for (; byte < nBytes; byte++)
+      {
+        CRC_UNROLL_LANES
+        for (uint8_t lane = 0; lane < CRC_BATCH_LANES; lane++)
+        {
+          lanes[lane] = (uint16_t)((lanes[lane] << 8) ^ Crc16Table[(lanes[lane] >> 8) ^ data[lane][byte]]);
+        }
+      }
+      break;
     }
     case CRC_CALC_SIZE_32:
     {
-      return (uint32_t)(Remainder ^ finalXorValue);
+#ifdef CRC32_SLICING_ENABLED
+      for (; byte + 8 <= nBytes; byte += 8)
+      {
+        CRC_UNROLL_LANES
+        for (uint8_t lane = 0; lane < CRC_BATCH_LANES; lane++)
+        {
+          lanes[lane] = StepCrc32Slicing8(lanes[lane], &data[lane][byte]);
+        }
+      }
+#else
+      for (; byte < nBytes; byte++)
+      {
+        CRC_UNROLL_LANES
+        for (uint8_t lane = 0; lane < CRC_BATCH_LANES; lane++)
+        {
+          lanes[lane] = (lanes[lane] << 8) ^ Crc32Table[(lanes[lane] >> 24) ^ data[lane][byte]];
+        }
+      }
+#endif
+      break;
+    }
+    case CRC_CALC_SIZE_32C:
+    {
+      for (; byte < nBytes; byte++)
+      {
+        CRC_UNROLL_LANES
+        for (uint8_t lane = 0; lane < CRC_BATCH_LANES; lane++)
+        {
+          lanes[lane] = (lanes[lane] >> 8) ^ Crc32cTable[(lanes[lane] ^ data[lane][byte]) & 0xFF];
+        }
+      }
+      break;
     }
   }
+
+  memcpy(remainder, lanes, sizeof(lanes));
+
+  return byte;
+#else
+  /* Bitwise algorithm has no lookup latency to hide */
+  return 0;
+#endif
 }
 
-/*======================================================================================*/
-/*                   ####### LOCAL FUNCTIONS DEFINITIONS #######                        */
-/*======================================================================================*/
+#ifdef CRC32_SLICING_ENABLED
+static inline uint32_t StepCrc32Slicing8(uint32_t remainder, uint8_t const *data)
+{
+  uint32_t word = remainder ^ LOAD_UINT32_BE(data);
+
+  return (Crc32SliceTable[6][word >> 24]          ^ Crc32SliceTable[5][(word >> 16) & 0xFF]
+        ^ Crc32SliceTable[4][(word >> 8) & 0xFF]  ^ Crc32SliceTable[3][word & 0xFF]
+        ^ Crc32SliceTable[2][data[4]]             ^ Crc32SliceTable[1][data[5]]
+        ^ Crc32SliceTable[0][data[6]]             ^ Crc32Table[data[7]]);
+}
+
+static uint32_t UpdateCrc32Slicing8(uint32_t remainder, uint8_t const *data, size_t nBlocks)
+{
+  for (size_t block = 0; block < nBlocks; block++, data += 8)
+  {
+    remainder = StepCrc32Slicing8(remainder, data);
+  }
+
+  return remainder;
+}
+
+#if CRC32_SLICING == 16
+static uint32_t UpdateCrc32Slicing16(uint32_t remainder, uint8_t const *data, size_t nBlocks)
+{
+  for (size_t block = 0; block < nBlocks; block++, data += 16)
+  {
+    uint32_t word = remainder ^ LOAD_UINT32_BE(data);
+
+    remainder = Crc32SliceTable[14][word >> 24]         ^ Crc32SliceTable[13][(word >> 16) & 0xFF]
+              ^ Crc32SliceTable[12][(word >> 8) & 0xFF] ^ Crc32SliceTable[11][word & 0xFF]
+              ^ Crc32SliceTable[10][data[4]]            ^ Crc32SliceTable[9][data[5]]
+              ^ Crc32SliceTable[8][data[6]]             ^ Crc32SliceTable[7][data[7]]
+              ^ Crc32SliceTable[6][data[8]]             ^ Crc32SliceTable[5][data[9]]
+              ^ Crc32SliceTable[4][data[10]]            ^ Crc32SliceTable[3][data[11]]
+              ^ Crc32SliceTable[2][data[12]]            ^ Crc32SliceTable[1][data[13]]
+              ^ Crc32SliceTable[0][data[14]]            ^ Crc32Table[data[15]];
+  }
+
+  return remainder;
+}
+#endif
+#endif
+
+#ifdef CRC_CLMUL_ENABLED
+/**
+ * @brief   Folds whole 16 bytes blocks of data with carry-less multiplication.
+ *
+ *          Remainder is XORed into the first 4 bytes, then every block is multiplied by x^128 mod P and added
+ *          to the next one, 4 blocks in parallel. The result is congruent modulo P to the message, so remainder
+ *          of the processed data is obtained by passing folded bytes through a table algorithm started from zero.
+ * @param   [out] folded    is folded data, 16 bytes in big endian order
+ * @param   [in] remainder  is current remainder aligned to MSB
+ * @param   [in] data       is pointer to data, at least 64 bytes long
+ * @param   [in] nBytes     is data length in bytes
+ * @param   [in] constants  is pointer to folding constants of CRC polynomial
+ * @return  Number of folded bytes.
+ */
+__attribute__((target("pclmul,ssse3")))
+static size_t FoldClmul(uint8_t folded[16], uint32_t remainder, uint8_t const *data, size_t nBytes,
+                        ClmulConstants_T const *constants)
+{
+  const __m128i byteSwap = _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+  const __m128i fold128 = _mm_loadu_si128((__m128i const*)constants->fold128);
+  const __m128i fold512 = _mm_loadu_si128((__m128i const*)constants->fold512);
+  __m128i block[4];
+  size_t offset;
+
+  for (uint8_t idx = 0; idx < 4; idx++)
+  {
+    block[idx] = _mm_shuffle_epi8(_mm_loadu_si128((__m128i const*)&data[16 * idx]), byteSwap);
+  }
+  block[0] = _mm_xor_si128(block[0], _mm_set_epi32((int32_t)remainder, 0, 0, 0));
+
+  for (offset = 64; offset + 64 <= nBytes; offset += 64)
+  {
+    for (uint8_t idx = 0; idx < 4; idx++)
+    {
+      __m128i next = _mm_shuffle_epi8(_mm_loadu_si128((__m128i const*)&data[offset + 16 * idx]), byteSwap);
+
+      block[idx] = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(block[idx], fold512, 0x11),
+                                               _mm_clmulepi64_si128(block[idx], fold512, 0x00)), next);
+    }
+  }
+
+  for (uint8_t idx = 1; idx < 4; idx++)
+  {
+    block[0] = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(block[0], fold128, 0x11),
+                                           _mm_clmulepi64_si128(block[0], fold128, 0x00)), block[idx]);
+  }
+
+  for (; offset + 16 <= nBytes; offset += 16)
+  {
+    __m128i next = _mm_shuffle_epi8(_mm_loadu_si128((__m128i const*)&data[offset]), byteSwap);
+
+    block[0] = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(block[0], fold128, 0x11),
+                                           _mm_clmulepi64_si128(block[0], fold128, 0x00)), next);
+  }
+
+  _mm_storeu_si128((__m128i*)folded, _mm_shuffle_epi8(block[0], byteSwap));
+
+  return offset;
+}
+#endif
+
+#ifdef CRC_SSE42_ENABLED
+static inline uint64_t LoadUint64(uint8_t const *bytes)
+{
+  uint64_t word;
+
+  memcpy(&word, bytes, sizeof(word));
+
+  return word;
+}
+
+/* Only UpdateCrc32cThreeStreams is built with PCLMUL, so the kernel for CPUs without it cannot contain it */
+__attribute__((target("sse4.2")))
+static inline uint32_t UpdateCrc32cHw(uint32_t remainder, uint8_t const *data, size_t nBytes, bool isClmulUsed)
+{
+  uint64_t crc = remainder;
+
+  for (; (nBytes > 0) && (0 != ((uintptr_t)data & 7)); nBytes--)
+  {
+    crc = _mm_crc32_u8((uint32_t)crc, *data++);
+  }
+
+  if (true == isClmulUsed)
+  {
+    size_t nStreamBytes;
+
+    nStreamBytes = nBytes - nBytes % (3 * CRC32C_LONG_BLOCK);
+    crc = UpdateCrc32cThreeStreams((uint32_t)crc, data, nStreamBytes, CRC32C_LONG_BLOCK,
+                                   CRC32C_SHIFT_LONG_BLOCK, CRC32C_SHIFT_2_LONG_BLOCKS);
+    data += nStreamBytes;
+    nBytes -= nStreamBytes;
+
+    nStreamBytes = nBytes - nBytes % (3 * CRC32C_SHORT_BLOCK);
+    crc = UpdateCrc32cThreeStreams((uint32_t)crc, data, nStreamBytes, CRC32C_SHORT_BLOCK,
+                                   CRC32C_SHIFT_SHORT_BLOCK, CRC32C_SHIFT_2_SHORT_BLOCKS);
+    data += nStreamBytes;
+    nBytes -= nStreamBytes;
+  }
+
+  for (; nBytes >= 8; nBytes -= 8, data += 8)
+  {
+    crc = _mm_crc32_u64(crc, LoadUint64(data));
+  }
+
+  for (; nBytes > 0; nBytes--)
+  {
+    crc = _mm_crc32_u8((uint32_t)crc, *data++);
+  }
+
+  return (uint32_t)crc;
+}
+
+__attribute__((target("sse4.2")))
+static uint32_t UpdateCrc32cSse42(uint32_t remainder, uint8_t const *data, size_t nBytes)
+{
+  return UpdateCrc32cHw(remainder, data, nBytes, false);
+}
+
+__attribute__((target("sse4.2,pclmul")))
+static uint32_t UpdateCrc32cSse42Clmul(uint32_t remainder, uint8_t const *data, size_t nBytes)
+{
+  return UpdateCrc32cHw(remainder, data, nBytes, true);
+}
+
+/**
+ * @brief   Calculates CRC-32C of three adjacent blocks at once to hide latency of crc32 instruction.
+ *
+ *          Blocks CRCs are merged by shifting them over following blocks: CRC of a block multiplied
+ *          by x^(8 * n - 33) mod P and reduced with crc32 instruction equals CRC of the block followed
+ *          by n zero bytes.
+ * @param   [in] remainder      is current remainder
+ * @param   [in] data           is pointer to 8 bytes aligned data
+ * @param   [in] nBytes         is data length in bytes, multiple of 3 * blockSize
+ * @param   [in] blockSize      is block length in bytes, multiple of 8
+ * @param   [in] shiftBlock     is shift constant for blockSize zero bytes
+ * @param   [in] shift2Blocks   is shift constant for 2 * blockSize zero bytes
+ * @return  Updated remainder.
+ */
+__attribute__((target("sse4.2,pclmul")))
+static uint32_t UpdateCrc32cThreeStreams(uint32_t remainder, uint8_t const *data, size_t nBytes, size_t blockSize,
+                                         uint32_t shiftBlock, uint32_t shift2Blocks)
+{
+  const __m128i shift = _mm_set_epi64x(shiftBlock, shift2Blocks);
+
+  for (; nBytes > 0; nBytes -= 3 * blockSize, data += 3 * blockSize)
+  {
+    uint64_t crc0 = remainder;
+    uint64_t crc1 = 0;
+    uint64_t crc2 = 0;
+    __m128i crcs;
+
+    for (size_t offset = 0; offset < blockSize; offset += 8)
+    {
+      crc0 = _mm_crc32_u64(crc0, LoadUint64(&data[offset]));
+      crc1 = _mm_crc32_u64(crc1, LoadUint64(&data[offset + blockSize]));
+      crc2 = _mm_crc32_u64(crc2, LoadUint64(&data[offset + 2 * blockSize]));
+    }
+
+    crcs = _mm_set_epi64x((int64_t)crc1, (int64_t)crc0);
+    crc0 = _mm_crc32_u64(0, (uint64_t)_mm_cvtsi128_si64(_mm_clmulepi64_si128(crcs, shift, 0x00)));
+    crc1 = _mm_crc32_u64(0, (uint64_t)_mm_cvtsi128_si64(_mm_clmulepi64_si128(crcs, shift, 0x11)));
+
+    remainder = (uint32_t)(crc0 ^ crc1 ^ crc2);
+  }
+
+  return remainder;
+}
+
+__attribute__((target("sse4.2")))
+static size_t UpdateCrc32cLanesSse42(uint32_t remainder[CRC_BATCH_LANES], uint8_t const * const data[], size_t nBytes)
+{
+  uint64_t crc[CRC_BATCH_LANES];
+  size_t offset;
+
+  for (uint8_t lane = 0; lane < CRC_BATCH_LANES; lane++)
+  {
+    crc[lane] = remainder[lane];
+  }
+
+  for (offset = 0; offset + 8 <= nBytes; offset += 8)
+  {
+    CRC_UNROLL_LANES
+    for (uint8_t lane = 0; lane < CRC_BATCH_LANES; lane++)
+    {
+      crc[lane] = _mm_crc32_u64(crc[lane], LoadUint64(&data[lane][offset]));
+    }
+  }
+
+  for (uint8_t lane = 0; lane < CRC_BATCH_LANES; lane++)
+  {
+    remainder[lane] = (uint32_t)crc[lane];
+  }
+
+  return offset;
+}
+
+/**
+ * @brief   Copies data with non-temporal stores, destination is not read into cache.
+ *
+ *          Stores are weakly ordered, caller has to issue store fence after the last block.
+ */
+static void CopyStreaming(uint8_t *dst, uint8_t const *src, size_t nBytes)
+{
+  size_t nHeadBytes = (16 - ((uintptr_t)dst & 15)) & 15;
+
+  if (nHeadBytes > nBytes)
+  {
+    nHeadBytes = nBytes;
+  }
+
+  memcpy(dst, src, nHeadBytes);
+  dst += nHeadBytes;
+  src += nHeadBytes;
+  nBytes -= nHeadBytes;
+
+  for (; nBytes >= 64; nBytes -= 64, dst += 64, src += 64)
+  {
+    __m128i block0 = _mm_loadu_si128((__m128i const*)&src[0]);
+    __m128i block1 = _mm_loadu_si128((__m128i const*)&src[16]);
+    __m128i block2 = _mm_loadu_si128((__m128i const*)&src[32]);
+    __m128i block3 = _mm_loadu_si128((__m128i const*)&src[48]);
+
+    _mm_stream_si128((__m128i*)&dst[0], block0);
+    _mm_stream_si128((__m128i*)&dst[16], block1);
+    _mm_stream_si128((__m128i*)&dst[32], block2);
+    _mm_stream_si128((__m128i*)&dst[48], block3);
+  }
+
+  memcpy(dst, src, nBytes);
+}
+#endif
+
+#ifdef CPUF_RESOLVER
+CPUF_RESOLVER static void ResolveKernels(void)
+{
+#ifdef CRC_SSE42_ENABLED
+  if (true == CPUF_IsSupported(CPUF_FEATURE_SSE42))
+  {
+    Kernels.updateCrc32c = (true == CPUF_IsSupported(CPUF_FEATURE_PCLMUL)) ? UpdateCrc32cSse42Clmul
+                                                                           : UpdateCrc32cSse42;
+    Kernels.updateCrc32cLanes = UpdateCrc32cLanesSse42;
+  }
+#endif
+
+#ifdef CRC_CLMUL_ENABLED
+  if (true == CPUF_IsSupported(CPUF_FEATURE_PCLMUL | CPUF_FEATURE_SSSE3))
+  {
+    Kernels.foldClmul = FoldClmul;
+  }
+#endif
+}
+#endif
 
 /**
  * @}
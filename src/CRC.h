@@ -24,8 +24,27 @@
 /*                       ####### PREPROCESSOR DIRECTIVES #######                        */
 /*======================================================================================*/
 /*-------------------------------- INCLUDE DIRECTIVES ----------------------------------*/
+#include <stdint.h>
+#include <stddef.h>
 
 /*----------------------------- LOCAL OBJECT-LIKE MACROS -------------------------------*/
+/** CRC calculation methods, one of them is selected by #CRC_CALC_METHOD */
+#define CRC_CALC_METHOD_BITWISE       1   ///< Bit at a time, no lookup tables, the smallest code size
+#define CRC_CALC_METHOD_TABLE         2   ///< Byte at a time, 256 entries lookup table per CRC size
+#define CRC_CALC_METHOD_NIBBLE        3   ///< Nibble at a time, 16 entries lookup table per CRC size, for small flash
+
+#ifndef CRC_CALC_METHOD
+#define CRC_CALC_METHOD               CRC_CALC_METHOD_TABLE
+#endif
+
+/**
+ * Number of lookup tables used by CRC32 slicing algorithm for long buffers: 0 (disabled), 8 or 16.
+ * Slicing tables are constant, so they are placed in flash, and take 1 KiB per table, except the first one.
+ * Slicing is available only with #CRC_CALC_METHOD_TABLE.
+ */
+#ifndef CRC32_SLICING
+#define CRC32_SLICING                 16
+#endif
 
 /*---------------------------- LOCAL FUNCTION-LIKE MACROS ------------------------------*/
 
@@ -40,9 +59,23 @@ typedef enum CRC_CalcSize_Tag
   CRC_CALC_SIZE_8 = 1,
   CRC_CALC_SIZE_16,
   CRC_CALC_SIZE_32,
+  CRC_CALC_SIZE_32C,            ///< CRC-32C (Castagnoli), hardware accelerated where available
 } CRC_CalcSize_T;
 
 /*------------------------------- STRUCT AND UNIONS ------------------------------------*/
+/** CRC calculation context, each calculated stream needs its own context */
+typedef struct CRC_Ctx_Tag
+{
+  CRC_CalcSize_T crcSize;       ///< Size of calculated CRC
+  uint32_t remainder;           ///< Remainder of data processed so far
+} CRC_Ctx_T;
+
+/** Data segment of scatter-gather CRC calculation */
+typedef struct CRC_Segment_Tag
+{
+  void const *pData;            ///< Pointer to segment data
+  size_t nBytes;                ///< Segment length in bytes
+} CRC_Segment_T;
 
 /*======================================================================================*/
 /*                    ####### EXPORTED OBJECT DECLARATIONS #######                      */
@@ -51,12 +84,127 @@ typedef enum CRC_CalcSize_Tag
 /*======================================================================================*/
 /*                   ####### EXPORTED FUNCTIONS PROTOTYPES #######                      */
 /*======================================================================================*/
-uint8_t  CRC_CalcCRC8(uint8_t *data, uint16_t nBytes);
-uint16_t CRC_CalcCRC16(uint8_t *data, uint16_t nBytes);
-uint32_t CRC_CalcCRC32(uint8_t *data, uint16_t nBytes);
+uint8_t  CRC_CalcCRC8(uint8_t const *data, size_t nBytes);
+uint16_t CRC_CalcCRC16(uint8_t const *data, size_t nBytes);
+uint32_t CRC_CalcCRC32(uint8_t const *data, size_t nBytes);
+uint32_t CRC_CalcCRC32C(uint8_t const *data, size_t nBytes);
 void CRC_CalcIterateStart(CRC_CalcSize_T crcSize);
 uint32_t CRC_CalcIterate(uint8_t byte, CRC_CalcSize_T crcSize);
 
+
+/**
+ * @brief   This function initializes CRC calculation context.
+ * @param   [out] ctx       is pointer to context
+ * @param   [in] crcSize    is size of calculated CRC
+ */
+void CRC_CtxInit(CRC_Ctx_T * const ctx, CRC_CalcSize_T crcSize);
+
+
+/**
+ * @brief   This function updates CRC calculation context with next part of data.
+ * @param   [in,out] ctx    is pointer to context initialized by #CRC_CtxInit
+ * @param   [in] data       is pointer to data
+ * @param   [in] nBytes     is data length in bytes
+ */
+void CRC_CtxUpdate(CRC_Ctx_T * const ctx, void const * const data, size_t nBytes);
+
+
+/**
+ * @brief   This function updates CRC calculation context with data gathered from segments, in order.
+ * @param   [in,out] ctx    is pointer to context initialized by #CRC_CtxInit
+ * @param   [in] segments   is array of segments, empty segments are allowed
+ * @param   [in] nSegments  is number of segments
+ */
+void CRC_CtxUpdateSegments(CRC_Ctx_T * const ctx, CRC_Segment_T const segments[], size_t nSegments);
+
+
+/**
+ * @brief   This function returns CRC of data processed so far. Context can be updated further.
+ * @param   [in] ctx        is pointer to context
+ * @return  CRC value.
+ */
+uint32_t CRC_CtxFinal(CRC_Ctx_T const * const ctx);
+
+
+/**
+ * @brief   This function copies data and updates CRC calculation context with it in a single pass.
+ *
+ *          Data is processed in blocks small enough to stay in L1 cache between copying and CRC calculation,
+ *          so every byte is fetched from memory once.
+ * @param   [in,out] ctx    is pointer to context initialized by #CRC_CtxInit
+ * @param   [out] dst       is pointer to destination, must not overlap source
+ * @param   [in] src        is pointer to source data
+ * @param   [in] nBytes     is data length in bytes
+ */
+void CRC_CtxCopyAndUpdate(CRC_Ctx_T * const ctx, void * const dst, void const * const src, size_t nBytes);
+
+uint8_t  CRC_CalcSegmentsCRC8(CRC_Segment_T const segments[], size_t nSegments);
+uint16_t CRC_CalcSegmentsCRC16(CRC_Segment_T const segments[], size_t nSegments);
+uint32_t CRC_CalcSegmentsCRC32(CRC_Segment_T const segments[], size_t nSegments);
+uint32_t CRC_CalcSegmentsCRC32C(CRC_Segment_T const segments[], size_t nSegments);
+
+uint8_t  CRC_CopyAndCalcCRC8(uint8_t *dst, uint8_t const *src, size_t nBytes);
+uint16_t CRC_CopyAndCalcCRC16(uint8_t *dst, uint8_t const *src, size_t nBytes);
+uint32_t CRC_CopyAndCalcCRC32(uint8_t *dst, uint8_t const *src, size_t nBytes);
+uint32_t CRC_CopyAndCalcCRC32C(uint8_t *dst, uint8_t const *src, size_t nBytes);
+
+
+/**
+ * @brief   This function calculates CRC of concatenated data A and B from CRCs of A and B, in O(log(nBytesB)) time.
+ * @param   [in] crcSize    is size of combined CRCs
+ * @param   [in] crcA       is CRC of data A
+ * @param   [in] crcB       is CRC of data B
+ * @param   [in] nBytesB    is length of data B in bytes
+ * @return  CRC of data A followed by data B.
+ */
+uint32_t CRC_Combine(CRC_CalcSize_T crcSize, uint32_t crcA, uint32_t crcB, size_t nBytesB);
+
+uint8_t  CRC_CombineCRC8(uint8_t crcA, uint8_t crcB, size_t nBytesB);
+uint16_t CRC_CombineCRC16(uint16_t crcA, uint16_t crcB, size_t nBytesB);
+uint32_t CRC_CombineCRC32(uint32_t crcA, uint32_t crcB, size_t nBytesB);
+uint32_t CRC_CombineCRC32C(uint32_t crcA, uint32_t crcB, size_t nBytesB);
+
+
+/**
+ * @brief   This function updates CRC of data after some of its bytes changed, in O(nBytes + log(dataSize)) time.
+ * @param   [in] crcSize    is size of the CRC
+ * @param   [in] crc        is CRC of data before the change
+ * @param   [in] dataSize   is length of whole data in bytes
+ * @param   [in] offset     is offset of changed bytes
+ * @param   [in] oldBytes   is pointer to bytes before the change
+ * @param   [in] newBytes   is pointer to bytes after the change
+ * @param   [in] nBytes     is number of changed bytes
+ * @return  CRC of data after the change, or unchanged crc when changed bytes exceed data, i.e. when
+ *          offset + nBytes is greater than dataSize.
+ */
+uint32_t CRC_Patch(CRC_CalcSize_T crcSize, uint32_t crc, size_t dataSize, size_t offset, void const * const oldBytes,
+                   void const * const newBytes, size_t nBytes);
+
+uint8_t  CRC_PatchCRC8(uint8_t crc, size_t dataSize, size_t offset, void const * const oldBytes,
+                       void const * const newBytes, size_t nBytes);
+uint16_t CRC_PatchCRC16(uint16_t crc, size_t dataSize, size_t offset, void const * const oldBytes,
+                        void const * const newBytes, size_t nBytes);
+uint32_t CRC_PatchCRC32(uint32_t crc, size_t dataSize, size_t offset, void const * const oldBytes,
+                        void const * const newBytes, size_t nBytes);
+uint32_t CRC_PatchCRC32C(uint32_t crc, size_t dataSize, size_t offset, void const * const oldBytes,
+                         void const * const newBytes, size_t nBytes);
+
+
+/**
+ * @brief   This function calculates CRCs of many independent buffers in one call.
+ *
+ *          Buffers are processed in groups, common length of a group is processed by interleaved lookups
+ *          (or crc32 instructions where available) to hide their latency, so throughput on short buffers approaches
+ *          throughput on long ones. Groups of adjacent buffers of similar length benefit the most.
+ * @param   [in] crcSize    is size of calculated CRCs
+ * @param   [in] data       is array of pointers to buffers
+ * @param   [in] nBytes     is array of buffers lengths in bytes
+ * @param   [out] crc       is array of calculated CRCs
+ * @param   [in] nBuffers   is number of buffers
+ */
+void CRC_CalcBatch(CRC_CalcSize_T crcSize, uint8_t const * const data[], size_t const nBytes[], uint32_t crc[],
+                   size_t nBuffers);
+
 /*======================================================================================*/
 /*                          ####### INLINE FUNCTIONS #######                            */
 /*======================================================================================*/
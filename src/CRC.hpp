@@ -0,0 +1,291 @@
+/*=======================================================================================*
+ * @file    CRC.hpp
+ * @author  Damian Pala
+ * @date    18-10-2026
+ * @brief   Header file for compile-time CRC calculations in C++
+ *
+ *          This file contains constexpr counterparts of CRC module functions. Requires C++14.
+ *          Results are equal to CRC_CalcCRC8/16/32/32C of the same bytes.
+ *======================================================================================*/
+/*----------------------- DEFINE TO PREVENT RECURSIVE INCLUSION ------------------------*/
+#ifndef CRC_HPP_
+#define CRC_HPP_
+
+/**
+ * @addtogroup CRC_Cpp Description
+ * @{
+ * @brief Compile-time CRC calculations.
+ *
+ *        Lookup tables are generated as constexpr arrays, so CRC of string literals and
+ *        constant byte arrays is evaluated by the compiler, e.g.
+ *
+ *          constexpr uint16_t signature = CRC::CalcCRC16("SEEPM");
+ *          static_assert(CRC::CalcCRC32C("123456789") == 0xE3069283, "");
+ *          using namespace CRC::Literals;
+ *          constexpr uint32_t messageId = "Config/Update"_crc32;
+ */
+
+/*======================================================================================*/
+/*                       ####### PREPROCESSOR DIRECTIVES #######                        */
+/*======================================================================================*/
+/*-------------------------------- INCLUDE DIRECTIVES ----------------------------------*/
+#include <cstddef>
+#include <cstdint>
+
+#if __cplusplus < 201402L && !(defined(_MSVC_LANG) && _MSVC_LANG >= 201402L)
+#error CRC.hpp requires C++14!
+#endif
+
+namespace CRC
+{
+
+/*======================================================================================*/
+/*                     ####### EXPORTED TYPE DECLARATIONS #######                       */
+/*======================================================================================*/
+/** Lookup table of 256 entries usable in constant expressions */
+template <typename T>
+struct Table
+{
+  T entries[256];
+
+  constexpr T operator[](std::size_t idx) const
+  {
+    return entries[idx];
+  }
+};
+
+namespace Detail
+{
+
+/* Parameters have to be kept equal to the ones in CRC.c */
+constexpr std::uint8_t CRC8_INITIAL_VALUE = 0xF1;
+constexpr std::uint16_t CRC16_INITIAL_VALUE = 0xF1F1;
+constexpr std::uint32_t CRC32_INITIAL_VALUE = 0xF1F1F1F1;
+constexpr std::uint32_t CRC32C_INITIAL_VALUE = 0xFFFFFFFF;
+
+constexpr std::uint8_t CRC8_FINAL_XOR_VALUE = 0xAB;
+constexpr std::uint16_t CRC16_FINAL_XOR_VALUE = 0xABAB;
+constexpr std::uint32_t CRC32_FINAL_XOR_VALUE = 0xABABABAB;
+constexpr std::uint32_t CRC32C_FINAL_XOR_VALUE = 0xFFFFFFFF;
+
+constexpr std::uint8_t CRC8_POLYNOMIAL = 0xE0;
+constexpr std::uint16_t CRC16_POLYNOMIAL = 0x8408;
+constexpr std::uint32_t CRC32_POLYNOMIAL = 0xEDB88320;
+constexpr std::uint32_t CRC32C_POLYNOMIAL = 0x82F63B78;     ///< Reflected, CRC-32C is calculated LSB first
+
+/*======================================================================================*/
+/*                          ####### INLINE FUNCTIONS #######                            */
+/*======================================================================================*/
+/** Generates table of MSB first algorithm, entry i is remainder for byte i shifted to MSB */
+template <typename T>
+constexpr Table<T> MakeTable(T polynomial)
+{
+  Table<T> table = {};
+  const unsigned shift = 8 * sizeof(T) - 8;
+  const T msBit = static_cast<T>(static_cast<T>(1) << (8 * sizeof(T) - 1));
+
+  for (unsigned idx = 0; idx < 256; idx++)
+  {
+    T remainder = static_cast<T>(static_cast<T>(idx) << shift);
+
+    for (unsigned bit = 0; bit < 8; bit++)
+    {
+      remainder = (remainder & msBit) ? static_cast<T>((remainder << 1) ^ polynomial)
+                                      : static_cast<T>(remainder << 1);
+    }
+
+    table.entries[idx] = remainder;
+  }
+
+  return table;
+}
+
+/** Generates table of LSB first (reflected) algorithm */
+constexpr Table<std::uint32_t> MakeReflectedTable(std::uint32_t polynomial)
+{
+  Table<std::uint32_t> table = {};
+
+  for (unsigned idx = 0; idx < 256; idx++)
+  {
+    std::uint32_t remainder = idx;
+
+    for (unsigned bit = 0; bit < 8; bit++)
+    {
+      remainder = (remainder & 1) ? ((remainder >> 1) ^ polynomial) : (remainder >> 1);
+    }
+
+    table.entries[idx] = remainder;
+  }
+
+  return table;
+}
+
+} /* namespace Detail */
+
+/*======================================================================================*/
+/*                    ####### EXPORTED OBJECT DECLARATIONS #######                      */
+/*======================================================================================*/
+constexpr Table<std::uint8_t> Crc8Table = Detail::MakeTable<std::uint8_t>(Detail::CRC8_POLYNOMIAL);
+constexpr Table<std::uint16_t> Crc16Table = Detail::MakeTable<std::uint16_t>(Detail::CRC16_POLYNOMIAL);
+constexpr Table<std::uint32_t> Crc32Table = Detail::MakeTable<std::uint32_t>(Detail::CRC32_POLYNOMIAL);
+constexpr Table<std::uint32_t> Crc32cTable = Detail::MakeReflectedTable(Detail::CRC32C_POLYNOMIAL);
+
+/*======================================================================================*/
+/*                          ####### INLINE FUNCTIONS #######                            */
+/*======================================================================================*/
+/**
+ * @brief   These functions calculate CRC of data, bytes are given as uint8_t or char.
+ * @param   [in] data       is pointer to data
+ * @param   [in] nBytes     is data length in bytes
+ * @return  CRC value.
+ */
+template <typename Byte>
+constexpr std::uint8_t CalcCRC8(Byte const *data, std::size_t nBytes)
+{
+  std::uint8_t remainder = Detail::CRC8_INITIAL_VALUE;
+
+  for (std::size_t byte = 0; byte < nBytes; byte++)
+  {
+    remainder = Crc8Table[remainder ^ static_cast<std::uint8_t>(data[byte])];
+  }
+
+  return static_cast<std::uint8_t>(remainder ^ Detail::CRC8_FINAL_XOR_VALUE);
+}
+
+template <typename Byte>
+constexpr std::uint16_t CalcCRC16(Byte const *data, std::size_t nBytes)
+{
+  std::uint16_t remainder = Detail::CRC16_INITIAL_VALUE;
+
+  for (std::size_t byte = 0; byte < nBytes; byte++)
+  {
+    remainder = static_cast<std::uint16_t>((remainder << 8)
+                                           ^ Crc16Table[(remainder >> 8) ^ static_cast<std::uint8_t>(data[byte])]);
+  }
+
+  return static_cast<std::uint16_t>(remainder ^ Detail::CRC16_FINAL_XOR_VALUE);
+}
+
+template <typename Byte>
+constexpr std::uint32_t CalcCRC32(Byte const *data, std::size_t nBytes)
+{
+  std::uint32_t remainder = Detail::CRC32_INITIAL_VALUE;
+
+  for (std::size_t byte = 0; byte < nBytes; byte++)
+  {
+    remainder = (remainder << 8) ^ Crc32Table[(remainder >> 24) ^ static_cast<std::uint8_t>(data[byte])];
+  }
+
+  return (remainder ^ Detail::CRC32_FINAL_XOR_VALUE);
+}
+
+template <typename Byte>
+constexpr std::uint32_t CalcCRC32C(Byte const *data, std::size_t nBytes)
+{
+  std::uint32_t remainder = Detail::CRC32C_INITIAL_VALUE;
+
+  for (std::size_t byte = 0; byte < nBytes; byte++)
+  {
+    remainder = (remainder >> 8) ^ Crc32cTable[(remainder ^ static_cast<std::uint8_t>(data[byte])) & 0xFF];
+  }
+
+  return (remainder ^ Detail::CRC32C_FINAL_XOR_VALUE);
+}
+
+/**
+ * @brief   These functions calculate CRC of string literal, terminating null character is not included.
+ * @param   [in] literal    is string literal
+ * @return  CRC value.
+ */
+template <std::size_t N>
+constexpr std::uint8_t CalcCRC8(char const (&literal)[N])
+{
+  return CalcCRC8(literal, N - 1);
+}
+
+template <std::size_t N>
+constexpr std::uint16_t CalcCRC16(char const (&literal)[N])
+{
+  return CalcCRC16(literal, N - 1);
+}
+
+template <std::size_t N>
+constexpr std::uint32_t CalcCRC32(char const (&literal)[N])
+{
+  return CalcCRC32(literal, N - 1);
+}
+
+template <std::size_t N>
+constexpr std::uint32_t CalcCRC32C(char const (&literal)[N])
+{
+  return CalcCRC32C(literal, N - 1);
+}
+
+/**
+ * @brief   These functions calculate CRC of whole byte array.
+ * @param   [in] data       is byte array
+ * @return  CRC value.
+ */
+template <std::size_t N>
+constexpr std::uint8_t CalcCRC8(std::uint8_t const (&data)[N])
+{
+  return CalcCRC8(data, N);
+}
+
+template <std::size_t N>
+constexpr std::uint16_t CalcCRC16(std::uint8_t const (&data)[N])
+{
+  return CalcCRC16(data, N);
+}
+
+template <std::size_t N>
+constexpr std::uint32_t CalcCRC32(std::uint8_t const (&data)[N])
+{
+  return CalcCRC32(data, N);
+}
+
+template <std::size_t N>
+constexpr std::uint32_t CalcCRC32C(std::uint8_t const (&data)[N])
+{
+  return CalcCRC32C(data, N);
+}
+
+/** User-defined literals, "text"_crc32 equals CalcCRC32("text") */
+namespace Literals
+{
+
+constexpr std::uint8_t operator""_crc8(char const *literal, std::size_t length)
+{
+  return CalcCRC8(literal, length);
+}
+
+constexpr std::uint16_t operator""_crc16(char const *literal, std::size_t length)
+{
+  return CalcCRC16(literal, length);
+}
+
+constexpr std::uint32_t operator""_crc32(char const *literal, std::size_t length)
+{
+  return CalcCRC32(literal, length);
+}
+
+constexpr std::uint32_t operator""_crc32c(char const *literal, std::size_t length)
+{
+  return CalcCRC32C(literal, length);
+}
+
+} /* namespace Literals */
+
+/* Check values of CRC module for "123456789" */
+static_assert(CalcCRC8("123456789") == 0x6B, "CRC8 parameters differ from CRC.c");
+static_assert(CalcCRC16("123456789") == 0x13C3, "CRC16 parameters differ from CRC.c");
+static_assert(CalcCRC32("123456789") == 0xAC5A764B, "CRC32 parameters differ from CRC.c");
+static_assert(CalcCRC32C("123456789") == 0xE3069283, "CRC32C parameters differ from CRC.c");
+
+} /* namespace CRC */
+
+/**
+ * @}
+ */
+
+#endif /* CRC_HPP_ */
@@ -0,0 +1,240 @@
+/*=======================================================================================*
+ * @file    CRCM.c
+ * @author  Damian Pala
+ * @date    18-10-2026
+ * @brief   This file contains all implementations for CRCM module.
+ *======================================================================================*/
+
+/**
+ * @addtogroup CRCM Description
+ * @{
+ * @brief Module for CRC calculations described by Rocksoft model parameters.
+ */
+
+/*======================================================================================*/
+/*                       ####### PREPROCESSOR DIRECTIVES #######                        */
+/*======================================================================================*/
+/*-------------------------------- INCLUDE DIRECTIVES ----------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "CRCM.h"
+
+/*----------------------------- LOCAL OBJECT-LIKE MACROS -------------------------------*/
+
+/*---------------------------- LOCAL FUNCTION-LIKE MACROS ------------------------------*/
+#define WIDTH_MASK(width)             (0xFFFFFFFF >> (32 - (width)))
+
+/*======================================================================================*/
+/*                      ####### LOCAL TYPE DECLARATIONS #######                         */
+/*======================================================================================*/
+/*-------------------------------- OTHER TYPEDEFS --------------------------------------*/
+
+/*------------------------------------- ENUMS ------------------------------------------*/
+
+/*------------------------------- STRUCT AND UNIONS ------------------------------------*/
+
+/*======================================================================================*/
+/*                         ####### OBJECT DEFINITIONS #######                           */
+/*======================================================================================*/
+/*--------------------------------- EXPORTED OBJECTS -----------------------------------*/
+const CRCM_Model_T CRCM_CRC5_USB =
+  {"CRC-5/USB",           5, 0x05,       0x1F,       true,  true,  0x1F,       0x19};
+const CRCM_Model_T CRCM_CRC7_MMC =
+  {"CRC-7/MMC",           7, 0x09,       0x00,       false, false, 0x00,       0x75};
+const CRCM_Model_T CRCM_CRC8_SMBUS =
+  {"CRC-8/SMBUS",         8, 0x07,       0x00,       false, false, 0x00,       0xF4};
+const CRCM_Model_T CRCM_CRC8_MAXIM_DOW =
+  {"CRC-8/MAXIM-DOW",     8, 0x31,       0x00,       true,  true,  0x00,       0xA1};
+const CRCM_Model_T CRCM_CRC8_AUTOSAR =
+  {"CRC-8/AUTOSAR",       8, 0x2F,       0xFF,       false, false, 0xFF,       0xDF};
+const CRCM_Model_T CRCM_CRC16_IBM_3740 =
+  {"CRC-16/IBM-3740",     16, 0x1021,     0xFFFF,     false, false, 0x0000,     0x29B1};
+const CRCM_Model_T CRCM_CRC16_KERMIT =
+  {"CRC-16/KERMIT",       16, 0x1021,     0x0000,     true,  true,  0x0000,     0x2189};
+const CRCM_Model_T CRCM_CRC16_XMODEM =
+  {"CRC-16/XMODEM",       16, 0x1021,     0x0000,     false, false, 0x0000,     0x31C3};
+const CRCM_Model_T CRCM_CRC16_MODBUS =
+  {"CRC-16/MODBUS",       16, 0x8005,     0xFFFF,     true,  true,  0x0000,     0x4B37};
+const CRCM_Model_T CRCM_CRC16_ARC =
+  {"CRC-16/ARC",          16, 0x8005,     0x0000,     true,  true,  0x0000,     0xBB3D};
+const CRCM_Model_T CRCM_CRC16_IBM_SDLC =
+  {"CRC-16/IBM-SDLC",     16, 0x1021,     0xFFFF,     true,  true,  0xFFFF,     0x906E};
+const CRCM_Model_T CRCM_CRC24_OPENPGP =
+  {"CRC-24/OPENPGP",      24, 0x864CFB,   0xB704CE,   false, false, 0x000000,   0x21CF02};
+const CRCM_Model_T CRCM_CRC32_ISO_HDLC =
+  {"CRC-32/ISO-HDLC",     32, 0x04C11DB7, 0xFFFFFFFF, true,  true,  0xFFFFFFFF, 0xCBF43926};
+const CRCM_Model_T CRCM_CRC32_ISCSI =
+  {"CRC-32/ISCSI",        32, 0x1EDC6F41, 0xFFFFFFFF, true,  true,  0xFFFFFFFF, 0xE3069283};
+const CRCM_Model_T CRCM_CRC32_BZIP2 =
+  {"CRC-32/BZIP2",        32, 0x04C11DB7, 0xFFFFFFFF, false, false, 0xFFFFFFFF, 0xFC891918};
+const CRCM_Model_T CRCM_CRC32_MPEG2 =
+  {"CRC-32/MPEG-2",       32, 0x04C11DB7, 0xFFFFFFFF, false, false, 0x00000000, 0x0376E6E7};
+
+const CRCM_Model_T * const CRCM_Catalog[] =
+{
+  &CRCM_CRC5_USB,
+  &CRCM_CRC7_MMC,
+  &CRCM_CRC8_SMBUS,
+  &CRCM_CRC8_MAXIM_DOW,
+  &CRCM_CRC8_AUTOSAR,
+  &CRCM_CRC16_IBM_3740,
+  &CRCM_CRC16_KERMIT,
+  &CRCM_CRC16_XMODEM,
+  &CRCM_CRC16_MODBUS,
+  &CRCM_CRC16_ARC,
+  &CRCM_CRC16_IBM_SDLC,
+  &CRCM_CRC24_OPENPGP,
+  &CRCM_CRC32_ISO_HDLC,
+  &CRCM_CRC32_ISCSI,
+  &CRCM_CRC32_BZIP2,
+  &CRCM_CRC32_MPEG2,
+  NULL
+};
+
+/*---------------------------------- LOCAL OBJECTS -------------------------------------*/
+
+/*======================================================================================*/
+/*                    ####### LOCAL FUNCTIONS PROTOTYPES #######                        */
+/*======================================================================================*/
+static uint32_t ReflectBits(uint32_t value, uint8_t width);
+
+/*======================================================================================*/
+/*                  ####### EXPORTED FUNCTIONS DEFINITIONS #######                      */
+/*======================================================================================*/
+CRCM_Model_T const* CRCM_FindModel(char const * const name)
+{
+  for (uint8_t idx = 0; NULL != CRCM_Catalog[idx]; idx++)
+  {
+    if (0 == strcmp(CRCM_Catalog[idx]->name, name))
+    {
+      return CRCM_Catalog[idx];
+    }
+  }
+
+  return NULL;
+}
+
+bool CRCM_Init(CRCM_Engine_T * const engine, CRCM_Model_T const * const model)
+{
+  if ( (model->width < 1) || (model->width > 32) )
+  {
+    return false;
+  }
+
+  engine->pModel = model;
+
+  if (true == model->refIn)
+  {
+    uint32_t polynomial = ReflectBits(model->polynomial, model->width);
+
+    for (uint16_t idx = 0; idx < 256; idx++)
+    {
+      uint32_t remainder = idx;
+
+      for (uint8_t nBit = 0; nBit < 8; nBit++)
+      {
+        remainder = (remainder & 1) ? ((remainder >> 1) ^ polynomial) : (remainder >> 1);
+      }
+
+      engine->table[idx] = remainder;
+    }
+  }
+  else
+  {
+    uint32_t polynomial = model->polynomial << (32 - model->width);
+
+    for (uint16_t idx = 0; idx < 256; idx++)
+    {
+      uint32_t remainder = (uint32_t)idx << 24;
+
+      for (uint8_t nBit = 0; nBit < 8; nBit++)
+      {
+        remainder = (remainder & 0x80000000) ? ((remainder << 1) ^ polynomial) : (remainder << 1);
+      }
+
+      engine->table[idx] = remainder;
+    }
+  }
+
+  return true;
+}
+
+uint32_t CRCM_Calc(CRCM_Engine_T const * const engine, void const * const data, size_t nBytes)
+{
+  return CRCM_Finish(engine, CRCM_Update(engine, CRCM_Start(engine), data, nBytes));
+}
+
+uint32_t CRCM_Start(CRCM_Engine_T const * const engine)
+{
+  CRCM_Model_T const *model = engine->pModel;
+
+  if (true == model->refIn)
+  {
+    return ReflectBits(model->init, model->width);
+  }
+  else
+  {
+    return model->init << (32 - model->width);
+  }
+}
+
+uint32_t CRCM_Update(CRCM_Engine_T const * const engine, uint32_t reg, void const * const data, size_t nBytes)
+{
+  uint8_t const *bytes = (uint8_t const*)data;
+
+  if (true == engine->pModel->refIn)
+  {
+    for (size_t byte = 0; byte < nBytes; byte++)
+    {
+      reg = (reg >> 8) ^ engine->table[(reg ^ bytes[byte]) & 0xFF];
+    }
+  }
+  else
+  {
+    for (size_t byte = 0; byte < nBytes; byte++)
+    {
+      reg = (reg << 8) ^ engine->table[(reg >> 24) ^ bytes[byte]];
+    }
+  }
+
+  return reg;
+}
+
+uint32_t CRCM_Finish(CRCM_Engine_T const * const engine, uint32_t reg)
+{
+  CRCM_Model_T const *model = engine->pModel;
+
+  if (false == model->refIn)
+  {
+    reg >>= 32 - model->width;
+  }
+
+  if (model->refIn != model->refOut)
+  {
+    reg = ReflectBits(reg, model->width);
+  }
+
+  return ((reg ^ model->xorOut) & WIDTH_MASK(model->width));
+}
+
+/*======================================================================================*/
+/*                   ####### LOCAL FUNCTIONS DEFINITIONS #######                        */
+/*======================================================================================*/
+static uint32_t ReflectBits(uint32_t value, uint8_t width)
+{
+  uint32_t reflected = 0;
+
+  for (uint8_t bit = 0; bit < width; bit++)
+  {
+    reflected = (reflected << 1) | ((value >> bit) & 1);
+  }
+
+  return reflected;
+}
+
+/**
+ * @}
+ */
@@ -0,0 +1,161 @@
+/*=======================================================================================*
+ * @file    CRCM.h
+ * @author  Damian Pala
+ * @date    18-10-2026
+ * @brief   Header file for CRCM module
+ *
+ *          This file contains API of CRCM module
+ *======================================================================================*/
+/*----------------------- DEFINE TO PREVENT RECURSIVE INCLUSION ------------------------*/
+#ifndef CRCM_H_
+#define CRCM_H_
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/**
+ * @addtogroup CRCM Description
+ * @{
+ * @brief Module for CRC calculations described by Rocksoft model parameters.
+ *
+ *        CRC algorithm is described by #CRCM_Model_T, catalog of standard models is provided.
+ *        Lookup table of a model is generated once by #CRCM_Init into engine object owned by the user,
+ *        the engine is then used for any number of calculations.
+ */
+
+/*======================================================================================*/
+/*                       ####### PREPROCESSOR DIRECTIVES #######                        */
+/*======================================================================================*/
+/*-------------------------------- INCLUDE DIRECTIVES ----------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/*----------------------------- LOCAL OBJECT-LIKE MACROS -------------------------------*/
+
+/*---------------------------- LOCAL FUNCTION-LIKE MACROS ------------------------------*/
+
+/*======================================================================================*/
+/*                     ####### EXPORTED TYPE DECLARATIONS #######                       */
+/*======================================================================================*/
+/*-------------------------------- OTHER TYPEDEFS --------------------------------------*/
+
+/*------------------------------------- ENUMS ------------------------------------------*/
+
+/*------------------------------- STRUCT AND UNIONS ------------------------------------*/
+/** CRC algorithm parameters according to Rocksoft model */
+typedef struct CRCM_Model_Tag
+{
+  char const *name;             ///< Name of the algorithm
+  uint8_t width;                ///< CRC width in bits, from 1 to 32
+  uint32_t polynomial;          ///< Polynomial in normal form, without the x^width term
+  uint32_t init;                ///< Initial register value, not reflected
+  bool refIn;                   ///< Input bytes are processed LSB first
+  bool refOut;                  ///< Register is reflected before final XOR
+  uint32_t xorOut;              ///< Final XOR value
+  uint32_t check;               ///< CRC of ASCII string "123456789"
+} CRCM_Model_T;
+
+/** CRC engine, holds lookup table generated for a model */
+typedef struct CRCM_Engine_Tag
+{
+  CRCM_Model_T const *pModel;   ///< Model of the engine
+  uint32_t table[256];          ///< Lookup table, reflected for refIn models, aligned to MSB otherwise
+} CRCM_Engine_T;
+
+/*======================================================================================*/
+/*                    ####### EXPORTED OBJECT DECLARATIONS #######                      */
+/*======================================================================================*/
+extern const CRCM_Model_T CRCM_CRC5_USB;
+extern const CRCM_Model_T CRCM_CRC7_MMC;
+extern const CRCM_Model_T CRCM_CRC8_SMBUS;
+extern const CRCM_Model_T CRCM_CRC8_MAXIM_DOW;
+extern const CRCM_Model_T CRCM_CRC8_AUTOSAR;
+extern const CRCM_Model_T CRCM_CRC16_IBM_3740;          ///< Known as CRC-16/CCITT-FALSE
+extern const CRCM_Model_T CRCM_CRC16_KERMIT;            ///< Known as CRC-16/CCITT
+extern const CRCM_Model_T CRCM_CRC16_XMODEM;
+extern const CRCM_Model_T CRCM_CRC16_MODBUS;
+extern const CRCM_Model_T CRCM_CRC16_ARC;
+extern const CRCM_Model_T CRCM_CRC16_IBM_SDLC;          ///< Known as CRC-16/X-25
+extern const CRCM_Model_T CRCM_CRC24_OPENPGP;
+extern const CRCM_Model_T CRCM_CRC32_ISO_HDLC;          ///< Known as CRC-32, used by Ethernet and zlib
+extern const CRCM_Model_T CRCM_CRC32_ISCSI;             ///< Known as CRC-32C
+extern const CRCM_Model_T CRCM_CRC32_BZIP2;
+extern const CRCM_Model_T CRCM_CRC32_MPEG2;
+
+/** All models above, terminated by NULL */
+extern const CRCM_Model_T * const CRCM_Catalog[];
+
+/*======================================================================================*/
+/*                   ####### EXPORTED FUNCTIONS PROTOTYPES #######                      */
+/*======================================================================================*/
+/**
+ * @brief   This function finds model in the catalog by its name.
+ * @param   [in] name       is model name, e.g. "CRC-16/MODBUS"
+ * @return  Pointer to model or NULL if not found.
+ */
+CRCM_Model_T const* CRCM_FindModel(char const * const name);
+
+
+/**
+ * @brief   This function initializes engine for given model and generates its lookup table.
+ * @param   [out] engine    is pointer to engine
+ * @param   [in] model      is pointer to model, it has to be valid as long as the engine is used
+ * @return  Result of the initialization.
+ * @retval  true if engine initialized properly
+ * @retval  false if model width is not supported
+ */
+bool CRCM_Init(CRCM_Engine_T * const engine, CRCM_Model_T const * const model);
+
+
+/**
+ * @brief   This function calculates CRC of data.
+ * @param   [in] engine     is pointer to initialized engine
+ * @param   [in] data       is pointer to data
+ * @param   [in] nBytes     is data length in bytes
+ * @return  CRC value.
+ */
+uint32_t CRCM_Calc(CRCM_Engine_T const * const engine, void const * const data, size_t nBytes);
+
+
+/**
+ * @brief   This function returns initial register for incremental calculation.
+ * @param   [in] engine     is pointer to initialized engine
+ * @return  Register value to be passed to #CRCM_Update.
+ */
+uint32_t CRCM_Start(CRCM_Engine_T const * const engine);
+
+
+/**
+ * @brief   This function updates register with next part of data.
+ * @param   [in] engine     is pointer to initialized engine
+ * @param   [in] reg        is register returned by #CRCM_Start or previous #CRCM_Update
+ * @param   [in] data       is pointer to data
+ * @param   [in] nBytes     is data length in bytes
+ * @return  Updated register.
+ */
+uint32_t CRCM_Update(CRCM_Engine_T const * const engine, uint32_t reg, void const * const data, size_t nBytes);
+
+
+/**
+ * @brief   This function calculates CRC value from register.
+ * @param   [in] engine     is pointer to initialized engine
+ * @param   [in] reg        is register returned by #CRCM_Update
+ * @return  CRC value.
+ */
+uint32_t CRCM_Finish(CRCM_Engine_T const * const engine, uint32_t reg);
+
+/*======================================================================================*/
+/*                          ####### INLINE FUNCTIONS #######                            */
+/*======================================================================================*/
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CRCM_H_ */
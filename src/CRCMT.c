@@ -0,0 +1,357 @@
+/*=======================================================================================*
+ * @file    CRCMT.c
+ * @author  Damian Pala
+ * @date    18-10-2026
+ * @brief   This file contains all implementations for CRCMT module.
+ *======================================================================================*/
+
+/**
+ * @addtogroup CRCMT Description
+ * @{
+ * @brief Module for multi-threaded CRC calculations of huge buffers.
+ */
+
+/*======================================================================================*/
+/*                       ####### PREPROCESSOR DIRECTIVES #######                        */
+/*======================================================================================*/
+/*-------------------------------- INCLUDE DIRECTIVES ----------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <pthread.h>
+
+#include "CRCMT.h"
+#include "CRC.h"
+
+/*----------------------------- LOCAL OBJECT-LIKE MACROS -------------------------------*/
+
+/*---------------------------- LOCAL FUNCTION-LIKE MACROS ------------------------------*/
+
+/*======================================================================================*/
+/*                      ####### LOCAL TYPE DECLARATIONS #######                         */
+/*======================================================================================*/
+/*-------------------------------- OTHER TYPEDEFS --------------------------------------*/
+
+/*------------------------------------- ENUMS ------------------------------------------*/
+
+/*------------------------------- STRUCT AND UNIONS ------------------------------------*/
+typedef struct Chunk_Tag
+{
+  CRC_CalcSize_T crcSize;
+  uint8_t const *data;
+  size_t nBytes;
+  uint32_t crc;
+} Chunk_T;
+
+/*======================================================================================*/
+/*                         ####### OBJECT DEFINITIONS #######                           */
+/*======================================================================================*/
+/*--------------------------------- EXPORTED OBJECTS -----------------------------------*/
+
+/*---------------------------------- LOCAL OBJECTS -------------------------------------*/
+
+/*======================================================================================*/
+/*                    ####### LOCAL FUNCTIONS PROTOTYPES #######                        */
+/*======================================================================================*/
+static void* CalcChunkCrc(void *pChunk);
+static void* RunWorker(void *pPool);
+static void CalcJobCrc(CRCMT_Job_T * const job);
+static void CompleteJob(CRCMT_Pool_T * const pool, CRCMT_Job_T * const job);
+
+/*======================================================================================*/
+/*                  ####### EXPORTED FUNCTIONS DEFINITIONS #######                      */
+/*======================================================================================*/
+uint32_t CRCMT_Calc(CRC_CalcSize_T crcSize, void const * const data, size_t nBytes, uint8_t nThreads)
+{
+  Chunk_T chunks[CRCMT_MAX_THREADS];
+  pthread_t threads[CRCMT_MAX_THREADS];
+  bool isThreadStarted[CRCMT_MAX_THREADS];
+  size_t chunkSize;
+  uint32_t crc;
+
+  if (nThreads > CRCMT_MAX_THREADS)
+  {
+    nThreads = CRCMT_MAX_THREADS;
+  }
+  if (nThreads > nBytes / CRCMT_MIN_CHUNK_SIZE)
+  {
+    nThreads = (uint8_t)(nBytes / CRCMT_MIN_CHUNK_SIZE);
+  }
+  if (0 == nThreads)
+  {
+    nThreads = 1;
+  }
+
+  chunkSize = nBytes / nThreads;
+
+  for (uint8_t thread = 0; thread < nThreads; thread++)
+  {
+    chunks[thread].crcSize = crcSize;
+    chunks[thread].data = (uint8_t const*)data + thread * chunkSize;
+    chunks[thread].nBytes = (thread == nThreads - 1) ? (nBytes - thread * chunkSize) : chunkSize;
+  }
+
+  for (uint8_t thread = 1; thread < nThreads; thread++)
+  {
+    isThreadStarted[thread] = (0 == pthread_create(&threads[thread], NULL, CalcChunkCrc, &chunks[thread]));
+  }
+
+  CalcChunkCrc(&chunks[0]);
+  crc = chunks[0].crc;
+
+  for (uint8_t thread = 1; thread < nThreads; thread++)
+  {
+    if (true == isThreadStarted[thread])
+    {
+      pthread_join(threads[thread], NULL);
+    }
+    else
+    {
+      CalcChunkCrc(&chunks[thread]);
+    }
+
+    crc = CRC_Combine(crcSize, crc, chunks[thread].crc, chunks[thread].nBytes);
+  }
+
+  return crc;
+}
+
+bool CRCMT_PoolInit(CRCMT_Pool_T * const pool, CRCMT_Job_T *queue[], uint16_t queueSize, uint8_t nThreads)
+{
+  if ( (NULL == queue) || (0 == queueSize) )
+  {
+    return false;
+  }
+
+  if (nThreads > CRCMT_MAX_THREADS)
+  {
+    nThreads = CRCMT_MAX_THREADS;
+  }
+
+  pool->queue = queue;
+  pool->queueSize = queueSize;
+  pool->head = 0;
+  pool->tail = 0;
+  pool->nQueued = 0;
+  pool->nPending = 0;
+  pool->firstCompleted = NULL;
+  pool->lastCompleted = NULL;
+  pool->isStopped = false;
+  pool->nThreads = 0;
+
+  pthread_mutex_init(&pool->lock, NULL);
+  pthread_cond_init(&pool->jobQueued, NULL);
+  pthread_cond_init(&pool->slotFreed, NULL);
+  pthread_cond_init(&pool->jobCompleted, NULL);
+
+  for (uint8_t thread = 0; thread < nThreads; thread++)
+  {
+    if (0 == pthread_create(&pool->threads[pool->nThreads], NULL, RunWorker, pool))
+    {
+      pool->nThreads++;
+    }
+  }
+
+  if (0 == pool->nThreads)
+  {
+    pthread_mutex_destroy(&pool->lock);
+    pthread_cond_destroy(&pool->jobQueued);
+    pthread_cond_destroy(&pool->slotFreed);
+    pthread_cond_destroy(&pool->jobCompleted);
+    return false;
+  }
+
+  return true;
+}
+
+void CRCMT_PoolDeinit(CRCMT_Pool_T * const pool)
+{
+  pthread_mutex_lock(&pool->lock);
+  pool->isStopped = true;
+  pthread_cond_broadcast(&pool->jobQueued);
+  pthread_mutex_unlock(&pool->lock);
+
+  for (uint8_t thread = 0; thread < pool->nThreads; thread++)
+  {
+    pthread_join(pool->threads[thread], NULL);
+  }
+
+  /* Callbacks may submit jobs, they are calculated here as there are no workers anymore */
+  while (0 != CRCMT_PoolDrain(pool, false))
+  {
+    while (0 != pool->nQueued)
+    {
+      CRCMT_Job_T *job = pool->queue[pool->tail];
+
+      pool->tail = (uint16_t)((pool->tail + 1) % pool->queueSize);
+      pool->nQueued--;
+      CalcJobCrc(job);
+      CompleteJob(pool, job);
+    }
+  }
+
+  pthread_mutex_destroy(&pool->lock);
+  pthread_cond_destroy(&pool->jobQueued);
+  pthread_cond_destroy(&pool->slotFreed);
+  pthread_cond_destroy(&pool->jobCompleted);
+}
+
+bool CRCMT_PoolSubmit(CRCMT_Pool_T * const pool, CRCMT_Job_T * const job, bool isWaiting)
+{
+  pthread_mutex_lock(&pool->lock);
+
+  while ( (pool->nQueued == pool->queueSize) && (true == isWaiting) )
+  {
+    pthread_cond_wait(&pool->slotFreed, &pool->lock);
+  }
+
+  if (pool->nQueued == pool->queueSize)
+  {
+    pthread_mutex_unlock(&pool->lock);
+    return false;
+  }
+
+  pool->queue[pool->head] = job;
+  pool->head = (uint16_t)((pool->head + 1) % pool->queueSize);
+  pool->nQueued++;
+  pool->nPending++;
+  pthread_cond_signal(&pool->jobQueued);
+
+  pthread_mutex_unlock(&pool->lock);
+
+  return true;
+}
+
+size_t CRCMT_PoolDrain(CRCMT_Pool_T * const pool, bool isWaiting)
+{
+  CRCMT_Job_T *job;
+  size_t nDrained = 0;
+
+  pthread_mutex_lock(&pool->lock);
+
+  while ( (NULL == pool->firstCompleted) && (0 != pool->nPending) && (true == isWaiting) )
+  {
+    pthread_cond_wait(&pool->jobCompleted, &pool->lock);
+  }
+
+  job = pool->firstCompleted;
+  pool->firstCompleted = NULL;
+  pool->lastCompleted = NULL;
+
+  for (CRCMT_Job_T *completed = job; NULL != completed; completed = completed->next)
+  {
+    nDrained++;
+  }
+  pool->nPending -= nDrained;
+
+  pthread_mutex_unlock(&pool->lock);
+
+  while (NULL != job)
+  {
+    /* Callback may reuse the job, so next one is taken before */
+    CRCMT_Job_T *next = job->next;
+
+    if (NULL != job->callback)
+    {
+      job->callback(job);
+    }
+
+    job = next;
+  }
+
+  return nDrained;
+}
+
+size_t CRCMT_PoolGetPendingJobs(CRCMT_Pool_T * const pool)
+{
+  size_t nPending;
+
+  pthread_mutex_lock(&pool->lock);
+  nPending = pool->nPending;
+  pthread_mutex_unlock(&pool->lock);
+
+  return nPending;
+}
+
+/*======================================================================================*/
+/*                   ####### LOCAL FUNCTIONS DEFINITIONS #######                        */
+/*======================================================================================*/
+static void* CalcChunkCrc(void *pChunk)
+{
+  Chunk_T *chunk = (Chunk_T*)pChunk;
+  CRC_Ctx_T ctx;
+
+  CRC_CtxInit(&ctx, chunk->crcSize);
+  CRC_CtxUpdate(&ctx, chunk->data, chunk->nBytes);
+  chunk->crc = CRC_CtxFinal(&ctx);
+
+  return NULL;
+}
+
+static void CalcJobCrc(CRCMT_Job_T * const job)
+{
+  CRC_Ctx_T ctx;
+
+  CRC_CtxInit(&ctx, job->crcSize);
+  CRC_CtxUpdate(&ctx, job->data, job->nBytes);
+  job->crc = CRC_CtxFinal(&ctx);
+}
+
+/* Pool must be locked. Drain is woken only by the first job of a batch, the next ones join the list. */
+static void CompleteJob(CRCMT_Pool_T * const pool, CRCMT_Job_T * const job)
+{
+  job->next = NULL;
+
+  if (NULL == pool->lastCompleted)
+  {
+    pool->firstCompleted = job;
+    pthread_cond_signal(&pool->jobCompleted);
+  }
+  else
+  {
+    pool->lastCompleted->next = job;
+  }
+
+  pool->lastCompleted = job;
+}
+
+static void* RunWorker(void *pPool)
+{
+  CRCMT_Pool_T *pool = (CRCMT_Pool_T*)pPool;
+
+  pthread_mutex_lock(&pool->lock);
+
+  for (;;)
+  {
+    CRCMT_Job_T *job;
+
+    while ( (0 == pool->nQueued) && (false == pool->isStopped) )
+    {
+      pthread_cond_wait(&pool->jobQueued, &pool->lock);
+    }
+
+    if (0 == pool->nQueued)
+    {
+      break;
+    }
+
+    job = pool->queue[pool->tail];
+    pool->tail = (uint16_t)((pool->tail + 1) % pool->queueSize);
+    pool->nQueued--;
+    pthread_cond_signal(&pool->slotFreed);
+
+    pthread_mutex_unlock(&pool->lock);
+    CalcJobCrc(job);
+    pthread_mutex_lock(&pool->lock);
+
+    CompleteJob(pool, job);
+  }
+
+  pthread_mutex_unlock(&pool->lock);
+
+  return NULL;
+}
+
+/**
+ * @}
+ */
@@ -0,0 +1,186 @@
+/*=======================================================================================*
+ * @file    CRCMT.h
+ * @author  Damian Pala
+ * @date    18-10-2026
+ * @brief   Header file for CRCMT module
+ *
+ *          This file contains API of CRCMT module
+ *======================================================================================*/
+/*----------------------- DEFINE TO PREVENT RECURSIVE INCLUSION ------------------------*/
+#ifndef CRCMT_H_
+#define CRCMT_H_
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/**
+ * @addtogroup CRCMT Description
+ * @{
+ * @brief Module for multi-threaded CRC calculations of huge buffers.
+ *
+ *        Buffer is split into chunks calculated by worker threads, partial CRCs are merged
+ *        by #CRC_Combine. Module requires POSIX threads.
+ *
+ *        Pool of worker threads calculates CRCs of submitted jobs asynchronously, so that the caller
+ *        can read the next block meanwhile. Completed jobs are collected in a list and handed over
+ *        to the caller in batches by #CRCMT_PoolDrain, which calls job callbacks in the calling thread.
+ */
+
+/*======================================================================================*/
+/*                       ####### PREPROCESSOR DIRECTIVES #######                        */
+/*======================================================================================*/
+/*-------------------------------- INCLUDE DIRECTIVES ----------------------------------*/
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include <pthread.h>
+
+#include "CRC.h"
+
+/*----------------------------- LOCAL OBJECT-LIKE MACROS -------------------------------*/
+#ifndef CRCMT_MAX_THREADS
+#define CRCMT_MAX_THREADS             32                ///< Maximal number of threads used by one calculation
+#endif
+
+#ifndef CRCMT_MIN_CHUNK_SIZE
+#define CRCMT_MIN_CHUNK_SIZE          (256 * 1024)      ///< Minimal number of bytes calculated by one thread
+#endif
+
+/*---------------------------- LOCAL FUNCTION-LIKE MACROS ------------------------------*/
+
+/*======================================================================================*/
+/*                     ####### EXPORTED TYPE DECLARATIONS #######                       */
+/*======================================================================================*/
+/*-------------------------------- OTHER TYPEDEFS --------------------------------------*/
+
+/*------------------------------------- ENUMS ------------------------------------------*/
+
+/*------------------------------- STRUCT AND UNIONS ------------------------------------*/
+typedef struct CRCMT_Job_Tag CRCMT_Job_T;
+
+/** Job completion callback, called by #CRCMT_PoolDrain in the thread which drains the pool */
+typedef void (*CRCMT_JobCallback_T)(CRCMT_Job_T *job);
+
+/** CRC calculation job, job memory belongs to the caller and must be valid until its callback is called */
+struct CRCMT_Job_Tag
+{
+  CRC_CalcSize_T crcSize;       ///< Size of calculated CRC
+  void const *data;             ///< Pointer to data, must not be modified until job is completed
+  size_t nBytes;                ///< Data length in bytes
+  CRCMT_JobCallback_T callback; ///< Completion callback, may be NULL
+  void *userData;               ///< Caller data, not used by the pool
+  uint32_t crc;                 ///< Calculated CRC, valid in callback
+  CRCMT_Job_T *next;            ///< Next completed job, used by the pool
+};
+
+/** Pool of worker threads, its fields are used only by the pool */
+typedef struct CRCMT_Pool_Tag
+{
+  pthread_mutex_t lock;         ///< Protects all fields below
+  pthread_cond_t jobQueued;     ///< Signaled when job is queued or pool is stopped
+  pthread_cond_t slotFreed;     ///< Signaled when worker takes job from full queue
+  pthread_cond_t jobCompleted;  ///< Signaled when completed jobs list becomes not empty
+  CRCMT_Job_T **queue;          ///< Queue of submitted jobs, storage given by the caller
+  uint16_t queueSize;           ///< Queue size in jobs
+  uint16_t head;                ///< Index where next job is queued
+  uint16_t tail;                ///< Index of the oldest queued job
+  uint16_t nQueued;             ///< Number of jobs in queue
+  size_t nPending;              ///< Number of submitted jobs not drained yet
+  CRCMT_Job_T *firstCompleted;  ///< The oldest completed job
+  CRCMT_Job_T *lastCompleted;   ///< The newest completed job
+  bool isStopped;               ///< Set by #CRCMT_PoolDeinit
+  uint8_t nThreads;             ///< Number of worker threads
+  pthread_t threads[CRCMT_MAX_THREADS]; ///< Worker threads
+} CRCMT_Pool_T;
+
+/*======================================================================================*/
+/*                    ####### EXPORTED OBJECT DECLARATIONS #######                      */
+/*======================================================================================*/
+
+/*======================================================================================*/
+/*                   ####### EXPORTED FUNCTIONS PROTOTYPES #######                      */
+/*======================================================================================*/
+/**
+ * @brief   This function calculates CRC of buffer using many threads.
+ *
+ *          Number of threads is limited so that each thread calculates at least #CRCMT_MIN_CHUNK_SIZE bytes.
+ *          The calling thread calculates the first chunk. If thread cannot be created, its chunk is calculated
+ *          by the calling thread.
+ * @param   [in] crcSize    is size of calculated CRC
+ * @param   [in] data       is pointer to data
+ * @param   [in] nBytes     is data length in bytes
+ * @param   [in] nThreads   is maximal number of threads, including the calling thread
+ * @return  CRC value, the same as calculated by CRC module in one thread.
+ */
+uint32_t CRCMT_Calc(CRC_CalcSize_T crcSize, void const * const data, size_t nBytes, uint8_t nThreads);
+
+
+/**
+ * @brief   This function initializes pool and starts its worker threads.
+ * @param   [out] pool      is pointer to pool
+ * @param   [in] queue      is storage of job queue, it must be valid until #CRCMT_PoolDeinit
+ * @param   [in] queueSize  is queue size in jobs, it limits number of jobs waiting for worker
+ * @param   [in] nThreads   is number of worker threads, limited to #CRCMT_MAX_THREADS
+ * @return  Result of the initialization.
+ * @retval  true if at least one worker thread is started
+ * @retval  false otherwise, pool must not be used
+ */
+bool CRCMT_PoolInit(CRCMT_Pool_T * const pool, CRCMT_Job_T *queue[], uint16_t queueSize, uint8_t nThreads);
+
+
+/**
+ * @brief   This function stops worker threads after they complete all queued jobs, then drains the pool.
+ *
+ *          Jobs submitted by callbacks during the drain are calculated in the calling thread, such callbacks
+ *          must not wait for free place in queue.
+ * @param   [in,out] pool   is pointer to pool initialized by #CRCMT_PoolInit
+ */
+void CRCMT_PoolDeinit(CRCMT_Pool_T * const pool);
+
+
+/**
+ * @brief   This function submits job to the pool.
+ * @param   [in,out] pool   is pointer to pool initialized by #CRCMT_PoolInit
+ * @param   [in] job        is pointer to job, its crcSize, data, nBytes and callback are set by the caller
+ * @param   [in] isWaiting  selects waiting for free place in queue if it is full
+ * @return  Result of the submission.
+ * @retval  true if job is queued
+ * @retval  false if queue is full and isWaiting is false
+ */
+bool CRCMT_PoolSubmit(CRCMT_Pool_T * const pool, CRCMT_Job_T * const job, bool isWaiting);
+
+
+/**
+ * @brief   This function calls callbacks of all jobs completed so far, in order of their completion.
+ *
+ *          Completed jobs are taken from the pool at once, so one call handles a whole batch of jobs with
+ *          one lock of the pool. Callbacks are called in the calling thread, without the pool locked, so they
+ *          may submit next jobs.
+ * @param   [in,out] pool   is pointer to pool initialized by #CRCMT_PoolInit
+ * @param   [in] isWaiting  selects waiting for at least one completed job, if any job is pending
+ * @return  Number of drained jobs.
+ */
+size_t CRCMT_PoolDrain(CRCMT_Pool_T * const pool, bool isWaiting);
+
+
+/**
+ * @brief   This function returns number of submitted jobs, which were not drained yet.
+ * @param   [in] pool       is pointer to pool initialized by #CRCMT_PoolInit
+ * @return  Number of pending jobs.
+ */
+size_t CRCMT_PoolGetPendingJobs(CRCMT_Pool_T * const pool);
+
+/*======================================================================================*/
+/*                          ####### INLINE FUNCTIONS #######                            */
+/*======================================================================================*/
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CRCMT_H_ */
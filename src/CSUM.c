@@ -0,0 +1,543 @@
+/*=======================================================================================*
+ * @file    CSUM.c
+ * @author  Damian Pala
+ * @date    18-10-2026
+ * @brief   This file contains all implementations for CSUM module.
+ *======================================================================================*/
+
+/**
+ * @addtogroup CSUM Description
+ * @{
+ * @brief Module for checksum calculations.
+ */
+
+/*======================================================================================*/
+/*                       ####### PREPROCESSOR DIRECTIVES #######                        */
+/*======================================================================================*/
+/*-------------------------------- INCLUDE DIRECTIVES ----------------------------------*/
+#include <stdint.h>
+#include <stddef.h>
+
+#include "CSUM.h"
+#include "CPUF.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+
+#define CSUM_SIMD_ENABLED
+#define CSUM_X86_ENABLED
+#elif defined(__ARM_NEON) && !defined(__ARM_BIG_ENDIAN)
+#include <arm_neon.h>
+
+#define CSUM_SIMD_ENABLED
+#define CSUM_NEON_ENABLED             ///< NEON is enabled by compiler flags, always on AArch64, kernels are selected at compile time
+#endif
+
+/*----------------------------- LOCAL OBJECT-LIKE MACROS -------------------------------*/
+#define ADLER32_MODULUS               65521
+#define ADLER32_NMAX                  5552  ///< Maximal number of bytes summed in 32 bits before reduction modulo
+#define FLETCHER32_MODULUS            65535
+#define FLETCHER32_NMAX_WORDS         359   ///< Maximal number of words summed in 32 bits before reduction modulo
+
+#define CSUM_SIMD_THRESHOLD           64    ///< Minimal data length in bytes processed by vector instructions
+/**
+ * Number of vectors summed in 32 bits lanes before reduction modulo. Sum of preceding vectors
+ * grows quadratically, 128 vectors of 16 bits words keep it below 2^31.
+ */
+#define CSUM_SIMD_BLOCK_VECTORS       128
+
+/*---------------------------- LOCAL FUNCTION-LIKE MACROS ------------------------------*/
+
+/*======================================================================================*/
+/*                      ####### LOCAL TYPE DECLARATIONS #######                         */
+/*======================================================================================*/
+/*-------------------------------- OTHER TYPEDEFS --------------------------------------*/
+
+/*------------------------------------- ENUMS ------------------------------------------*/
+
+/*------------------------------- STRUCT AND UNIONS ------------------------------------*/
+/**
+ * Kernels selected for the CPU by ResolveKernels, NULL kernel means that portable code is used.
+ * Kernel processes whole vectors and returns number of processed bytes.
+ */
+typedef struct CSUM_Kernels_Tag
+{
+  size_t (*updateAdler32)(uint32_t *sum1, uint32_t *sum2, uint8_t const *data, size_t nBytes);
+  size_t (*updateFletcher32)(uint32_t *sum1, uint32_t *sum2, uint8_t const *data, size_t nBytes);
+} CSUM_Kernels_T;
+
+/*======================================================================================*/
+/*                         ####### OBJECT DEFINITIONS #######                           */
+/*======================================================================================*/
+/*--------------------------------- EXPORTED OBJECTS -----------------------------------*/
+
+/*---------------------------------- LOCAL OBJECTS -------------------------------------*/
+#ifndef CSUM_NEON_ENABLED
+static CSUM_Kernels_T Kernels;
+#endif
+
+/*======================================================================================*/
+/*                    ####### LOCAL FUNCTIONS PROTOTYPES #######                        */
+/*======================================================================================*/
+static void UpdateAdler32Scalar(uint32_t *sum1, uint32_t *sum2, uint8_t const *data, size_t nBytes);
+static void UpdateFletcher32Scalar(uint32_t *sum1, uint32_t *sum2, uint8_t const *data, size_t nWords);
+#ifdef CSUM_SIMD_ENABLED
+static inline void AddBlockSums(uint32_t *sum1, uint32_t *sum2, uint32_t modulus, size_t nElements,
+                                uint32_t vectorElements, uint64_t blockSum, uint64_t prefixSum, uint64_t weightedSum);
+#endif
+#ifdef CSUM_X86_ENABLED
+static size_t UpdateAdler32Ssse3(uint32_t *sum1, uint32_t *sum2, uint8_t const *data, size_t nBytes);
+static size_t UpdateAdler32Avx2(uint32_t *sum1, uint32_t *sum2, uint8_t const *data, size_t nBytes);
+static size_t UpdateFletcher32Sse2(uint32_t *sum1, uint32_t *sum2, uint8_t const *data, size_t nBytes);
+static size_t UpdateFletcher32Avx2(uint32_t *sum1, uint32_t *sum2, uint8_t const *data, size_t nBytes);
+#endif
+#ifdef CSUM_NEON_ENABLED
+static size_t UpdateAdler32Neon(uint32_t *sum1, uint32_t *sum2, uint8_t const *data, size_t nBytes);
+static size_t UpdateFletcher32Neon(uint32_t *sum1, uint32_t *sum2, uint8_t const *data, size_t nBytes);
+#endif
+#ifdef CPUF_RESOLVER
+static void ResolveKernels(void);
+#endif
+
+/*======================================================================================*/
+/*                  ####### EXPORTED FUNCTIONS DEFINITIONS #######                      */
+/*======================================================================================*/
+uint32_t CSUM_CalcAdler32(uint8_t const *data, size_t nBytes)
+{
+  return CSUM_UpdateAdler32(CSUM_ADLER32_INITIAL_VALUE, data, nBytes);
+}
+
+uint32_t CSUM_UpdateAdler32(uint32_t adler, uint8_t const *data, size_t nBytes)
+{
+  uint32_t sum1 = adler & 0xFFFF;
+  uint32_t sum2 = adler >> 16;
+  size_t nProcessed = 0;
+
+#ifdef CSUM_NEON_ENABLED
+  if (nBytes >= CSUM_SIMD_THRESHOLD)
+  {
+    nProcessed = UpdateAdler32Neon(&sum1, &sum2, data, nBytes);
+  }
+#else
+  if ( (nBytes >= CSUM_SIMD_THRESHOLD) && (NULL != Kernels.updateAdler32) )
+  {
+    nProcessed = Kernels.updateAdler32(&sum1, &sum2, data, nBytes);
+  }
+#endif
+
+  UpdateAdler32Scalar(&sum1, &sum2, &data[nProcessed], nBytes - nProcessed);
+
+  return ((sum2 << 16) | sum1);
+}
+
+uint32_t CSUM_CalcFletcher32(uint8_t const *data, size_t nBytes)
+{
+  uint32_t sum1 = 0;
+  uint32_t sum2 = 0;
+  size_t nProcessed = 0;
+
+#ifdef CSUM_NEON_ENABLED
+  if (nBytes >= CSUM_SIMD_THRESHOLD)
+  {
+    nProcessed = UpdateFletcher32Neon(&sum1, &sum2, data, nBytes);
+  }
+#else
+  if ( (nBytes >= CSUM_SIMD_THRESHOLD) && (NULL != Kernels.updateFletcher32) )
+  {
+    nProcessed = Kernels.updateFletcher32(&sum1, &sum2, data, nBytes);
+  }
+#endif
+
+  UpdateFletcher32Scalar(&sum1, &sum2, &data[nProcessed], (nBytes - nProcessed) / 2);
+
+  if (0 != (nBytes & 1))
+  {
+    sum1 = (sum1 + data[nBytes - 1]) % FLETCHER32_MODULUS;
+    sum2 = (sum2 + sum1) % FLETCHER32_MODULUS;
+  }
+
+  return ((sum2 << 16) | sum1);
+}
+
+/*======================================================================================*/
+/*                   ####### LOCAL FUNCTIONS DEFINITIONS #######                        */
+/*======================================================================================*/
+static void UpdateAdler32Scalar(uint32_t *sum1, uint32_t *sum2, uint8_t const *data, size_t nBytes)
+{
+  uint32_t s1 = *sum1;
+  uint32_t s2 = *sum2;
+
+  while (nBytes > 0)
+  {
+    size_t nBlockBytes = (nBytes < ADLER32_NMAX) ? nBytes : ADLER32_NMAX;
+
+    nBytes -= nBlockBytes;
+
+    for (size_t byte = 0; byte < nBlockBytes; byte++)
+    {
+      s1 += data[byte];
+      s2 += s1;
+    }
+
+    data += nBlockBytes;
+    s1 %= ADLER32_MODULUS;
+    s2 %= ADLER32_MODULUS;
+  }
+
+  *sum1 = s1;
+  *sum2 = s2;
+}
+
+static void UpdateFletcher32Scalar(uint32_t *sum1, uint32_t *sum2, uint8_t const *data, size_t nWords)
+{
+  uint32_t s1 = *sum1;
+  uint32_t s2 = *sum2;
+
+  while (nWords > 0)
+  {
+    size_t nBlockWords = (nWords < FLETCHER32_NMAX_WORDS) ? nWords : FLETCHER32_NMAX_WORDS;
+
+    nWords -= nBlockWords;
+
+    for (size_t word = 0; word < nBlockWords; word++)
+    {
+      s1 += (uint32_t)data[2 * word] | ((uint32_t)data[2 * word + 1] << 8);
+      s2 += s1;
+    }
+
+    data += 2 * nBlockWords;
+    s1 %= FLETCHER32_MODULUS;
+    s2 %= FLETCHER32_MODULUS;
+  }
+
+  *sum1 = s1;
+  *sum2 = s2;
+}
+
+#ifdef CSUM_SIMD_ENABLED
+/**
+ * @brief   Adds sums of vectors block to checksum sums.
+ *
+ *          Element j of vector v of the block is added to the second sum as many times as there are
+ *          elements from it to the block end, it is vectorElements * (nVectors - 1 - v) + (vectorElements - j).
+ *          The first part is vectorElements times sum of all elements of preceding vectors, accumulated
+ *          in prefixSum, the second part is calculated per vector with descending weights.
+ * @param   [in,out] sum1           is first sum, reduced modulo
+ * @param   [in,out] sum2           is second sum, reduced modulo
+ * @param   [in] modulus            is checksum modulus
+ * @param   [in] nElements          is number of bytes or words in the block
+ * @param   [in] vectorElements     is number of bytes or words in a vector
+ * @param   [in] blockSum           is sum of all elements of the block
+ * @param   [in] prefixSum          is sum of sums of elements preceding every vector
+ * @param   [in] weightedSum        is sum of elements multiplied by descending weights within vectors
+ */
+static inline void AddBlockSums(uint32_t *sum1, uint32_t *sum2, uint32_t modulus, size_t nElements,
+                                uint32_t vectorElements, uint64_t blockSum, uint64_t prefixSum, uint64_t weightedSum)
+{
+  uint64_t s2 = *sum2 + (uint64_t)nElements * *sum1 + vectorElements * prefixSum + weightedSum;
+
+  *sum1 = (uint32_t)((*sum1 + blockSum) % modulus);
+  *sum2 = (uint32_t)(s2 % modulus);
+}
+#endif
+
+#ifdef CSUM_X86_ENABLED
+__attribute__((target("sse2")))
+static inline uint64_t SumLanes128(__m128i vector)
+{
+  uint32_t lanes[4];
+  uint64_t sum = 0;
+
+  _mm_storeu_si128((__m128i*)lanes, vector);
+
+  for (uint8_t idx = 0; idx < 4; idx++)
+  {
+    sum += lanes[idx];
+  }
+
+  return sum;
+}
+
+__attribute__((target("avx2")))
+static inline uint64_t SumLanes256(__m256i vector)
+{
+  return (SumLanes128(_mm256_castsi256_si128(vector)) + SumLanes128(_mm256_extracti128_si256(vector, 1)));
+}
+
+__attribute__((target("ssse3")))
+static size_t UpdateAdler32Ssse3(uint32_t *sum1, uint32_t *sum2, uint8_t const *data, size_t nBytes)
+{
+  const __m128i weights = _mm_setr_epi8(16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1);
+  const __m128i ones = _mm_set1_epi16(1);
+  const __m128i zero = _mm_setzero_si128();
+  size_t offset = 0;
+
+  while (nBytes - offset >= 16)
+  {
+    size_t nVectors = (nBytes - offset) / 16;
+    __m128i blockSum = zero;
+    __m128i prefixSum = zero;
+    __m128i weightedSum = zero;
+
+    if (nVectors > CSUM_SIMD_BLOCK_VECTORS)
+    {
+      nVectors = CSUM_SIMD_BLOCK_VECTORS;
+    }
+
+    for (size_t vector = 0; vector < nVectors; vector++)
+    {
+      __m128i bytes = _mm_loadu_si128((__m128i const*)&data[offset + 16 * vector]);
+
+      prefixSum = _mm_add_epi32(prefixSum, blockSum);
+      blockSum = _mm_add_epi32(blockSum, _mm_sad_epu8(bytes, zero));
+      weightedSum = _mm_add_epi32(weightedSum, _mm_madd_epi16(_mm_maddubs_epi16(bytes, weights), ones));
+    }
+
+    AddBlockSums(sum1, sum2, ADLER32_MODULUS, 16 * nVectors, 16,
+                 SumLanes128(blockSum), SumLanes128(prefixSum), SumLanes128(weightedSum));
+    offset += 16 * nVectors;
+  }
+
+  return offset;
+}
+
+__attribute__((target("avx2")))
+static size_t UpdateAdler32Avx2(uint32_t *sum1, uint32_t *sum2, uint8_t const *data, size_t nBytes)
+{
+  const __m256i weights = _mm256_setr_epi8(32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17,
+                                           16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1);
+  const __m256i ones = _mm256_set1_epi16(1);
+  const __m256i zero = _mm256_setzero_si256();
+  size_t offset = 0;
+
+  while (nBytes - offset >= 32)
+  {
+    size_t nVectors = (nBytes - offset) / 32;
+    __m256i blockSum = zero;
+    __m256i prefixSum = zero;
+    __m256i weightedSum = zero;
+
+    if (nVectors > CSUM_SIMD_BLOCK_VECTORS)
+    {
+      nVectors = CSUM_SIMD_BLOCK_VECTORS;
+    }
+
+    for (size_t vector = 0; vector < nVectors; vector++)
+    {
+      __m256i bytes = _mm256_loadu_si256((__m256i const*)&data[offset + 32 * vector]);
+
+      prefixSum = _mm256_add_epi32(prefixSum, blockSum);
+      blockSum = _mm256_add_epi32(blockSum, _mm256_sad_epu8(bytes, zero));
+      weightedSum = _mm256_add_epi32(weightedSum, _mm256_madd_epi16(_mm256_maddubs_epi16(bytes, weights), ones));
+    }
+
+    AddBlockSums(sum1, sum2, ADLER32_MODULUS, 32 * nVectors, 32,
+                 SumLanes256(blockSum), SumLanes256(prefixSum), SumLanes256(weightedSum));
+    offset += 32 * nVectors;
+  }
+
+  return offset;
+}
+
+/* Words are split into low and high bytes, because _mm_madd_epi16 multiplies signed words */
+__attribute__((target("sse2")))
+static size_t UpdateFletcher32Sse2(uint32_t *sum1, uint32_t *sum2, uint8_t const *data, size_t nBytes)
+{
+  const __m128i weights = _mm_setr_epi16(8, 7, 6, 5, 4, 3, 2, 1);
+  const __m128i ones = _mm_set1_epi16(1);
+  const __m128i lowBytes = _mm_set1_epi16(0x00FF);
+  size_t offset = 0;
+
+  while (nBytes - offset >= 16)
+  {
+    size_t nVectors = (nBytes - offset) / 16;
+    __m128i blockSum = _mm_setzero_si128();
+    __m128i prefixSum = _mm_setzero_si128();
+    __m128i weightedSum = _mm_setzero_si128();
+
+    if (nVectors > CSUM_SIMD_BLOCK_VECTORS)
+    {
+      nVectors = CSUM_SIMD_BLOCK_VECTORS;
+    }
+
+    for (size_t vector = 0; vector < nVectors; vector++)
+    {
+      __m128i words = _mm_loadu_si128((__m128i const*)&data[offset + 16 * vector]);
+      __m128i low = _mm_and_si128(words, lowBytes);
+      __m128i high = _mm_srli_epi16(words, 8);
+
+      prefixSum = _mm_add_epi32(prefixSum, blockSum);
+      blockSum = _mm_add_epi32(blockSum, _mm_add_epi32(_mm_madd_epi16(low, ones),
+                                                       _mm_slli_epi32(_mm_madd_epi16(high, ones), 8)));
+      weightedSum = _mm_add_epi32(weightedSum, _mm_add_epi32(_mm_madd_epi16(low, weights),
+                                                             _mm_slli_epi32(_mm_madd_epi16(high, weights), 8)));
+    }
+
+    AddBlockSums(sum1, sum2, FLETCHER32_MODULUS, 8 * nVectors, 8,
+                 SumLanes128(blockSum), SumLanes128(prefixSum), SumLanes128(weightedSum));
+    offset += 16 * nVectors;
+  }
+
+  return offset;
+}
+
+__attribute__((target("avx2")))
+static size_t UpdateFletcher32Avx2(uint32_t *sum1, uint32_t *sum2, uint8_t const *data, size_t nBytes)
+{
+  const __m256i weights = _mm256_setr_epi16(16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1);
+  const __m256i ones = _mm256_set1_epi16(1);
+  const __m256i lowBytes = _mm256_set1_epi16(0x00FF);
+  size_t offset = 0;
+
+  while (nBytes - offset >= 32)
+  {
+    size_t nVectors = (nBytes - offset) / 32;
+    __m256i blockSum = _mm256_setzero_si256();
+    __m256i prefixSum = _mm256_setzero_si256();
+    __m256i weightedSum = _mm256_setzero_si256();
+
+    if (nVectors > CSUM_SIMD_BLOCK_VECTORS)
+    {
+      nVectors = CSUM_SIMD_BLOCK_VECTORS;
+    }
+
+    for (size_t vector = 0; vector < nVectors; vector++)
+    {
+      __m256i words = _mm256_loadu_si256((__m256i const*)&data[offset + 32 * vector]);
+      __m256i low = _mm256_and_si256(words, lowBytes);
+      __m256i high = _mm256_srli_epi16(words, 8);
+
+      prefixSum = _mm256_add_epi32(prefixSum, blockSum);
+      blockSum = _mm256_add_epi32(blockSum, _mm256_add_epi32(_mm256_madd_epi16(low, ones),
+                                                             _mm256_slli_epi32(_mm256_madd_epi16(high, ones), 8)));
+      weightedSum = _mm256_add_epi32(weightedSum,
+                                     _mm256_add_epi32(_mm256_madd_epi16(low, weights),
+                                                      _mm256_slli_epi32(_mm256_madd_epi16(high, weights), 8)));
+    }
+
+    AddBlockSums(sum1, sum2, FLETCHER32_MODULUS, 16 * nVectors, 16,
+                 SumLanes256(blockSum), SumLanes256(prefixSum), SumLanes256(weightedSum));
+    offset += 32 * nVectors;
+  }
+
+  return offset;
+}
+#endif
+
+#ifdef CSUM_NEON_ENABLED
+static inline uint64_t SumLanesNeon(uint32x4_t vector)
+{
+  uint32_t lanes[4];
+  uint64_t sum = 0;
+
+  vst1q_u32(lanes, vector);
+
+  for (uint8_t idx = 0; idx < 4; idx++)
+  {
+    sum += lanes[idx];
+  }
+
+  return sum;
+}
+
+static size_t UpdateAdler32Neon(uint32_t *sum1, uint32_t *sum2, uint8_t const *data, size_t nBytes)
+{
+  static const uint8_t weightBytes[16] = {16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1};
+  const uint8x16_t weights = vld1q_u8(weightBytes);
+  size_t offset = 0;
+
+  while (nBytes - offset >= 16)
+  {
+    size_t nVectors = (nBytes - offset) / 16;
+    uint32x4_t blockSum = vdupq_n_u32(0);
+    uint32x4_t prefixSum = vdupq_n_u32(0);
+    uint32x4_t weightedSum = vdupq_n_u32(0);
+
+    if (nVectors > CSUM_SIMD_BLOCK_VECTORS)
+    {
+      nVectors = CSUM_SIMD_BLOCK_VECTORS;
+    }
+
+    for (size_t vector = 0; vector < nVectors; vector++)
+    {
+      uint8x16_t bytes = vld1q_u8(&data[offset + 16 * vector]);
+      uint16x8_t products = vmull_u8(vget_low_u8(bytes), vget_low_u8(weights));
+
+      products = vmlal_u8(products, vget_high_u8(bytes), vget_high_u8(weights));
+      prefixSum = vaddq_u32(prefixSum, blockSum);
+      blockSum = vpadalq_u16(blockSum, vpaddlq_u8(bytes));
+      weightedSum = vpadalq_u16(weightedSum, products);
+    }
+
+    AddBlockSums(sum1, sum2, ADLER32_MODULUS, 16 * nVectors, 16,
+                 SumLanesNeon(blockSum), SumLanesNeon(prefixSum), SumLanesNeon(weightedSum));
+    offset += 16 * nVectors;
+  }
+
+  return offset;
+}
+
+/* Words are loaded as little endian, CSUM_NEON_ENABLED is not defined for big endian targets */
+static size_t UpdateFletcher32Neon(uint32_t *sum1, uint32_t *sum2, uint8_t const *data, size_t nBytes)
+{
+  static const uint16_t weightWords[8] = {8, 7, 6, 5, 4, 3, 2, 1};
+  const uint16x8_t weights = vld1q_u16(weightWords);
+  size_t offset = 0;
+
+  while (nBytes - offset >= 16)
+  {
+    size_t nVectors = (nBytes - offset) / 16;
+    uint32x4_t blockSum = vdupq_n_u32(0);
+    uint32x4_t prefixSum = vdupq_n_u32(0);
+    uint32x4_t weightedSum = vdupq_n_u32(0);
+
+    if (nVectors > CSUM_SIMD_BLOCK_VECTORS)
+    {
+      nVectors = CSUM_SIMD_BLOCK_VECTORS;
+    }
+
+    for (size_t vector = 0; vector < nVectors; vector++)
+    {
+      uint16x8_t words = vreinterpretq_u16_u8(vld1q_u8(&data[offset + 16 * vector]));
+
+      prefixSum = vaddq_u32(prefixSum, blockSum);
+      blockSum = vpadalq_u16(blockSum, words);
+      weightedSum = vmlal_u16(weightedSum, vget_low_u16(words), vget_low_u16(weights));
+      weightedSum = vmlal_u16(weightedSum, vget_high_u16(words), vget_high_u16(weights));
+    }
+
+    AddBlockSums(sum1, sum2, FLETCHER32_MODULUS, 8 * nVectors, 8,
+                 SumLanesNeon(blockSum), SumLanesNeon(prefixSum), SumLanesNeon(weightedSum));
+    offset += 16 * nVectors;
+  }
+
+  return offset;
+}
+#endif
+
+#ifdef CPUF_RESOLVER
+CPUF_RESOLVER static void ResolveKernels(void)
+{
+  if (true == CPUF_IsSupported(CPUF_FEATURE_AVX2))
+  {
+    Kernels.updateAdler32 = UpdateAdler32Avx2;
+    Kernels.updateFletcher32 = UpdateFletcher32Avx2;
+  }
+  else
+  {
+    if (true == CPUF_IsSupported(CPUF_FEATURE_SSSE3))
+    {
+      Kernels.updateAdler32 = UpdateAdler32Ssse3;
+    }
+
+    if (true == CPUF_IsSupported(CPUF_FEATURE_SSE2))
+    {
+      Kernels.updateFletcher32 = UpdateFletcher32Sse2;
+    }
+  }
+}
+#endif
+
+/**
+ * @}
+ */
@@ -0,0 +1,98 @@
+/*=======================================================================================*
+ * @file    CSUM.h
+ * @author  Damian Pala
+ * @date    18-10-2026
+ * @brief   Header file for CSUM module
+ *
+ *          This file contains API of CSUM module
+ *======================================================================================*/
+/*----------------------- DEFINE TO PREVENT RECURSIVE INCLUSION ------------------------*/
+#ifndef CSUM_H_
+#define CSUM_H_
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/**
+ * @addtogroup CSUM Description
+ * @{
+ * @brief Module for checksum calculations.
+ *
+ *        Adler-32 and Fletcher-32 are much cheaper than CRC, but they detect fewer errors,
+ *        e.g. they are weak for short data and do not detect some bursts of zeroes or 0xFF.
+ *        They are intended for internal integrity checks, CRC should be used for protocols
+ *        and data stored for a long time.
+ */
+
+/*======================================================================================*/
+/*                       ####### PREPROCESSOR DIRECTIVES #######                        */
+/*======================================================================================*/
+/*-------------------------------- INCLUDE DIRECTIVES ----------------------------------*/
+#include <stdint.h>
+#include <stddef.h>
+
+/*----------------------------- LOCAL OBJECT-LIKE MACROS -------------------------------*/
+#define CSUM_ADLER32_INITIAL_VALUE    1     ///< Adler-32 of empty data, start value of #CSUM_UpdateAdler32
+
+/*---------------------------- LOCAL FUNCTION-LIKE MACROS ------------------------------*/
+
+/*======================================================================================*/
+/*                     ####### EXPORTED TYPE DECLARATIONS #######                       */
+/*======================================================================================*/
+/*-------------------------------- OTHER TYPEDEFS --------------------------------------*/
+
+/*------------------------------------- ENUMS ------------------------------------------*/
+
+/*------------------------------- STRUCT AND UNIONS ------------------------------------*/
+
+/*======================================================================================*/
+/*                    ####### EXPORTED OBJECT DECLARATIONS #######                      */
+/*======================================================================================*/
+
+/*======================================================================================*/
+/*                   ####### EXPORTED FUNCTIONS PROTOTYPES #######                      */
+/*======================================================================================*/
+/**
+ * @brief   This function calculates Adler-32 checksum of data, as defined by RFC 1950 (zlib).
+ * @param   [in] data       is pointer to data
+ * @param   [in] nBytes     is data length in bytes
+ * @return  Checksum value.
+ */
+uint32_t CSUM_CalcAdler32(uint8_t const *data, size_t nBytes);
+
+
+/**
+ * @brief   This function updates Adler-32 checksum with next part of data.
+ * @param   [in] adler      is checksum of data processed so far or #CSUM_ADLER32_INITIAL_VALUE
+ * @param   [in] data       is pointer to data
+ * @param   [in] nBytes     is data length in bytes
+ * @return  Checksum of all data processed so far.
+ */
+uint32_t CSUM_UpdateAdler32(uint32_t adler, uint8_t const *data, size_t nBytes);
+
+
+/**
+ * @brief   This function calculates Fletcher-32 checksum of data.
+ *
+ *          Data is summed as 16 bits little endian words modulo 65535, odd length data is padded
+ *          with zero byte. Sums start from zero, the second sum is returned in upper 16 bits.
+ * @param   [in] data       is pointer to data
+ * @param   [in] nBytes     is data length in bytes
+ * @return  Checksum value.
+ */
+uint32_t CSUM_CalcFletcher32(uint8_t const *data, size_t nBytes);
+
+/*======================================================================================*/
+/*                          ####### INLINE FUNCTIONS #######                            */
+/*======================================================================================*/
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CSUM_H_ */
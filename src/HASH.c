@@ -0,0 +1,845 @@
+/*=======================================================================================*
+ * @file    HASH.c
+ * @author  Damian Pala
+ * @date    18-10-2026
+ * @brief   This file contains all implementations for HASH module.
+ *======================================================================================*/
+
+/**
+ * @addtogroup HASH Description
+ * @{
+ * @brief Module for non-cryptographic hashing of keys and buffers.
+ */
+
+/*======================================================================================*/
+/*                       ####### PREPROCESSOR DIRECTIVES #######                        */
+/*======================================================================================*/
+/*-------------------------------- INCLUDE DIRECTIVES ----------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "HASH.h"
+#include "CPUF.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+
+#define HASH_SIMD_ENABLED
+#endif
+
+/*----------------------------- LOCAL OBJECT-LIKE MACROS -------------------------------*/
+#define XXH_PRIME32_1                 0x9E3779B1U
+#define XXH_PRIME32_2                 0x85EBCA77U
+#define XXH_PRIME32_3                 0xC2B2AE3DU
+#define XXH_PRIME32_4                 0x27D4EB2FU
+#define XXH_PRIME32_5                 0x165667B1U
+
+#define XXH_PRIME64_1                 0x9E3779B185EBCA87ULL
+#define XXH_PRIME64_2                 0xC2B2AE3D27D4EB4FULL
+#define XXH_PRIME64_3                 0x165667B19E3779F9ULL
+#define XXH_PRIME64_4                 0x85EBCA77C2B2AE63ULL
+#define XXH_PRIME64_5                 0x27D4EB2F165667C5ULL
+
+#define XXH32_STRIPE_SIZE             16
+
+#define XXH3_STRIPE_SIZE              64    ///< Input bytes processed by single accumulation of all accumulators
+#define XXH3_SECRET_CONSUME_RATE      8     ///< Secret bytes the key moves by for every stripe
+#define XXH3_SECRET_LIMIT             (HASH_XXH3_SECRET_SIZE - XXH3_STRIPE_SIZE)
+#define XXH3_STRIPES_PER_BLOCK        (XXH3_SECRET_LIMIT / XXH3_SECRET_CONSUME_RATE)
+#define XXH3_BLOCK_SIZE               (XXH3_STRIPE_SIZE * XXH3_STRIPES_PER_BLOCK)
+#define XXH3_BUFFER_STRIPES           (HASH_XXH3_BUFFER_SIZE / XXH3_STRIPE_SIZE)
+#define XXH3_MIDSIZE_MAX              240
+#define XXH3_MIDSIZE_START_OFFSET     3
+#define XXH3_MIDSIZE_LAST_OFFSET      17
+#define XXH3_SECRET_SIZE_MIN          136
+#define XXH3_SECRET_MERGEACCS_START   11
+#define XXH3_SECRET_LASTACC_START     7
+
+/*---------------------------- LOCAL FUNCTION-LIKE MACROS ------------------------------*/
+#define ROTL32(value, shift)          (((value) << (shift)) | ((value) >> (32 - (shift))))
+#define ROTL64(value, shift)          (((value) << (shift)) | ((value) >> (64 - (shift))))
+
+/* Keeps variable in general purpose register, SSE emulation of 32 bits multiplication slows XXH32 down 2 times */
+#ifdef __GNUC__
+#define VECTORIZATION_BARRIER(var)    __asm__("" : "+r" (var))
+#else
+#define VECTORIZATION_BARRIER(var)    ((void)0)
+#endif
+
+#ifdef __GNUC__
+#define SWAP_BYTES32(value)           __builtin_bswap32(value)
+#define SWAP_BYTES64(value)           __builtin_bswap64(value)
+#else
+#define SWAP_BYTES32(value)           ((((value) & 0xFF) << 24) | (((value) & 0xFF00) << 8) | \
+                                       (((value) >> 8) & 0xFF00) | ((value) >> 24))
+#define SWAP_BYTES64(value)           (((uint64_t)SWAP_BYTES32((uint32_t)(value)) << 32) | \
+                                       SWAP_BYTES32((uint32_t)((value) >> 32)))
+#endif
+
+/*======================================================================================*/
+/*                      ####### LOCAL TYPE DECLARATIONS #######                         */
+/*======================================================================================*/
+/*-------------------------------- OTHER TYPEDEFS --------------------------------------*/
+
+/*------------------------------------- ENUMS ------------------------------------------*/
+
+/*------------------------------- STRUCT AND UNIONS ------------------------------------*/
+/** Kernels selected for the CPU by ResolveKernels, NULL kernel means that portable code is used */
+typedef struct HASH_Kernels_Tag
+{
+  void (*xxh3Accumulate)(uint64_t acc[8], uint8_t const *data, uint8_t const *secret, size_t nStripes);
+  void (*xxh3Scramble)(uint64_t acc[8], uint8_t const *secret);
+} HASH_Kernels_T;
+
+/*======================================================================================*/
+/*                         ####### OBJECT DEFINITIONS #######                           */
+/*======================================================================================*/
+/*--------------------------------- EXPORTED OBJECTS -----------------------------------*/
+
+/*---------------------------------- LOCAL OBJECTS -------------------------------------*/
+/** Default secret of XXH3, the secret of seed 0 */
+static const uint8_t Xxh3DefaultSecret[HASH_XXH3_SECRET_SIZE] =
+{
+  0xB8, 0xFE, 0x6C, 0x39, 0x23, 0xA4, 0x4B, 0xBE, 0x7C, 0x01, 0x81, 0x2C, 0xF7, 0x21, 0xAD, 0x1C,
+  0xDE, 0xD4, 0x6D, 0xE9, 0x83, 0x90, 0x97, 0xDB, 0x72, 0x40, 0xA4, 0xA4, 0xB7, 0xB3, 0x67, 0x1F,
+  0xCB, 0x79, 0xE6, 0x4E, 0xCC, 0xC0, 0xE5, 0x78, 0x82, 0x5A, 0xD0, 0x7D, 0xCC, 0xFF, 0x72, 0x21,
+  0xB8, 0x08, 0x46, 0x74, 0xF7, 0x43, 0x24, 0x8E, 0xE0, 0x35, 0x90, 0xE6, 0x81, 0x3A, 0x26, 0x4C,
+  0x3C, 0x28, 0x52, 0xBB, 0x91, 0xC3, 0x00, 0xCB, 0x88, 0xD0, 0x65, 0x8B, 0x1B, 0x53, 0x2E, 0xA3,
+  0x71, 0x64, 0x48, 0x97, 0xA2, 0x0D, 0xF9, 0x4E, 0x38, 0x19, 0xEF, 0x46, 0xA9, 0xDE, 0xAC, 0xD8,
+  0xA8, 0xFA, 0x76, 0x3F, 0xE3, 0x9C, 0x34, 0x3F, 0xF9, 0xDC, 0xBB, 0xC7, 0xC7, 0x0B, 0x4F, 0x1D,
+  0x8A, 0x51, 0xE0, 0x4B, 0xCD, 0xB4, 0x59, 0x31, 0xC8, 0x9F, 0x7E, 0xC9, 0xD9, 0x78, 0x73, 0x64,
+  0xEA, 0xC5, 0xAC, 0x83, 0x34, 0xD3, 0xEB, 0xC3, 0xC5, 0x81, 0xA0, 0xFF, 0xFA, 0x13, 0x63, 0xEB,
+  0x17, 0x0D, 0xDD, 0x51, 0xB7, 0xF0, 0xDA, 0x49, 0xD3, 0x16, 0x55, 0x26, 0x29, 0xD4, 0x68, 0x9E,
+  0x2B, 0x16, 0xBE, 0x58, 0x7D, 0x47, 0xA1, 0xFC, 0x8F, 0xF8, 0xB8, 0xD1, 0x7A, 0xD0, 0x31, 0xCE,
+  0x45, 0xCB, 0x3A, 0x8F, 0x95, 0x16, 0x04, 0x28, 0xAF, 0xD7, 0xFB, 0xCA, 0xBB, 0x4B, 0x40, 0x7E
+};
+
+static HASH_Kernels_T Kernels;
+
+static const uint64_t Xxh3InitialAcc[8] =
+{
+  XXH_PRIME32_3, XXH_PRIME64_1, XXH_PRIME64_2, XXH_PRIME64_3,
+  XXH_PRIME64_4, XXH_PRIME32_2, XXH_PRIME64_5, XXH_PRIME32_1
+};
+
+/*======================================================================================*/
+/*                    ####### LOCAL FUNCTIONS PROTOTYPES #######                        */
+/*======================================================================================*/
+static inline uint32_t ReadUint32LE(uint8_t const *bytes);
+static inline uint64_t ReadUint64LE(uint8_t const *bytes);
+static inline void WriteUint64LE(uint8_t *bytes, uint64_t value);
+static inline uint64_t Mul128Fold64(uint64_t a, uint64_t b);
+
+static inline uint32_t Xxh32Round(uint32_t lane, uint32_t input);
+static void Xxh32InitLanes(uint32_t lanes[4], uint32_t seed);
+static void Xxh32ProcessStripes(uint32_t lanes[4], uint8_t const *data, size_t nStripes);
+static uint32_t Xxh32MergeLanes(uint32_t const lanes[4]);
+static uint32_t Xxh32Finalize(uint32_t hash, uint8_t const *data, size_t nBytes);
+
+static inline uint64_t Xxh64Avalanche(uint64_t hash);
+static inline uint64_t Xxh3Avalanche(uint64_t hash);
+static inline uint64_t Xxh3Mix16(uint8_t const *data, uint8_t const *secret, uint64_t seed);
+static uint64_t Xxh3Len0To16(uint8_t const *data, size_t nBytes, uint64_t seed);
+static uint64_t Xxh3Len17To128(uint8_t const *data, size_t nBytes, uint64_t seed);
+static uint64_t Xxh3Len129To240(uint8_t const *data, size_t nBytes, uint64_t seed);
+static void Xxh3InitSecret(uint8_t secret[HASH_XXH3_SECRET_SIZE], uint64_t seed);
+static void Xxh3Accumulate(uint64_t acc[8], uint8_t const *data, uint8_t const *secret, size_t nStripes);
+static void Xxh3Scramble(uint64_t acc[8], uint8_t const *secret);
+static void Xxh3ConsumeStripes(uint64_t acc[8], size_t *nStripesInBlock, uint8_t const *data, size_t nStripes,
+                               uint8_t const *secret);
+static uint64_t Xxh3MergeAccs(uint64_t const acc[8], uint8_t const *secret, uint64_t start);
+static uint64_t Xxh3HashLong(uint8_t const *data, size_t nBytes, uint8_t const *secret);
+#ifdef HASH_SIMD_ENABLED
+static void Xxh3AccumulateSse2(uint64_t acc[8], uint8_t const *data, uint8_t const *secret, size_t nStripes);
+static void Xxh3AccumulateAvx2(uint64_t acc[8], uint8_t const *data, uint8_t const *secret, size_t nStripes);
+static void Xxh3ScrambleSse2(uint64_t acc[8], uint8_t const *secret);
+static void Xxh3ScrambleAvx2(uint64_t acc[8], uint8_t const *secret);
+#endif
+#ifdef CPUF_RESOLVER
+static void ResolveKernels(void);
+#endif
+
+/*======================================================================================*/
+/*                  ####### EXPORTED FUNCTIONS DEFINITIONS #######                      */
+/*======================================================================================*/
+uint32_t HASH_Calc32(void const *data, size_t nBytes, uint32_t seed)
+{
+  uint8_t const *bytes = (uint8_t const*)data;
+  size_t nStripeBytes = nBytes & ~(size_t)(XXH32_STRIPE_SIZE - 1);
+  uint32_t hash;
+
+  if (nBytes >= XXH32_STRIPE_SIZE)
+  {
+    uint32_t lanes[4];
+
+    Xxh32InitLanes(lanes, seed);
+    Xxh32ProcessStripes(lanes, bytes, nBytes / XXH32_STRIPE_SIZE);
+    hash = Xxh32MergeLanes(lanes);
+  }
+  else
+  {
+    hash = seed + XXH_PRIME32_5;
+  }
+
+  hash += (uint32_t)nBytes;
+
+  return Xxh32Finalize(hash, &bytes[nStripeBytes], nBytes - nStripeBytes);
+}
+
+uint64_t HASH_Calc64(void const *data, size_t nBytes, uint64_t seed)
+{
+  uint8_t const *bytes = (uint8_t const*)data;
+
+  if (nBytes <= 16)
+  {
+    return Xxh3Len0To16(bytes, nBytes, seed);
+  }
+  else if (nBytes <= 128)
+  {
+    return Xxh3Len17To128(bytes, nBytes, seed);
+  }
+  else if (nBytes <= XXH3_MIDSIZE_MAX)
+  {
+    return Xxh3Len129To240(bytes, nBytes, seed);
+  }
+  else if (0 == seed)
+  {
+    return Xxh3HashLong(bytes, nBytes, Xxh3DefaultSecret);
+  }
+  else
+  {
+    uint8_t secret[HASH_XXH3_SECRET_SIZE];
+
+    Xxh3InitSecret(secret, seed);
+
+    return Xxh3HashLong(bytes, nBytes, secret);
+  }
+}
+
+void HASH_Ctx32Init(HASH_Ctx32_T * const ctx, uint32_t seed)
+{
+  ctx->seed = seed;
+  Xxh32InitLanes(ctx->lanes, seed);
+  ctx->totalBytes = 0;
+  ctx->nBufferedBytes = 0;
+}
+
+void HASH_Ctx32Update(HASH_Ctx32_T * const ctx, void const *data, size_t nBytes)
+{
+  uint8_t const *bytes = (uint8_t const*)data;
+
+  ctx->totalBytes += nBytes;
+
+  if (ctx->nBufferedBytes + nBytes < XXH32_STRIPE_SIZE)
+  {
+    memcpy(&ctx->buffer[ctx->nBufferedBytes], bytes, nBytes);
+    ctx->nBufferedBytes += (uint8_t)nBytes;
+    return;
+  }
+
+  if (0 != ctx->nBufferedBytes)
+  {
+    size_t nFillBytes = XXH32_STRIPE_SIZE - ctx->nBufferedBytes;
+
+    memcpy(&ctx->buffer[ctx->nBufferedBytes], bytes, nFillBytes);
+    Xxh32ProcessStripes(ctx->lanes, ctx->buffer, 1);
+    bytes += nFillBytes;
+    nBytes -= nFillBytes;
+  }
+
+  Xxh32ProcessStripes(ctx->lanes, bytes, nBytes / XXH32_STRIPE_SIZE);
+  ctx->nBufferedBytes = (uint8_t)(nBytes % XXH32_STRIPE_SIZE);
+  memcpy(ctx->buffer, &bytes[nBytes - ctx->nBufferedBytes], ctx->nBufferedBytes);
+}
+
+uint32_t HASH_Ctx32Final(HASH_Ctx32_T const * const ctx)
+{
+  uint32_t hash;
+
+  if (ctx->totalBytes >= XXH32_STRIPE_SIZE)
+  {
+    hash = Xxh32MergeLanes(ctx->lanes);
+  }
+  else
+  {
+    hash = ctx->seed + XXH_PRIME32_5;
+  }
+
+  hash += (uint32_t)ctx->totalBytes;
+
+  return Xxh32Finalize(hash, ctx->buffer, ctx->nBufferedBytes);
+}
+
+void HASH_Ctx64Init(HASH_Ctx64_T * const ctx, uint64_t seed)
+{
+  ctx->seed = seed;
+  memcpy(ctx->acc, Xxh3InitialAcc, sizeof(ctx->acc));
+  ctx->totalBytes = 0;
+  ctx->nStripesInBlock = 0;
+  ctx->nBufferedBytes = 0;
+  Xxh3InitSecret(ctx->secret, seed);
+}
+
+void HASH_Ctx64Update(HASH_Ctx64_T * const ctx, void const *data, size_t nBytes)
+{
+  uint8_t const *bytes = (uint8_t const*)data;
+
+  ctx->totalBytes += nBytes;
+
+  if (ctx->nBufferedBytes + nBytes <= HASH_XXH3_BUFFER_SIZE)
+  {
+    memcpy(&ctx->buffer[ctx->nBufferedBytes], bytes, nBytes);
+    ctx->nBufferedBytes += nBytes;
+    return;
+  }
+
+  /* The last stripe is always kept, it is processed differently when the hash is finalized */
+  if (0 != ctx->nBufferedBytes)
+  {
+    size_t nFillBytes = HASH_XXH3_BUFFER_SIZE - ctx->nBufferedBytes;
+
+    memcpy(&ctx->buffer[ctx->nBufferedBytes], bytes, nFillBytes);
+    Xxh3ConsumeStripes(ctx->acc, &ctx->nStripesInBlock, ctx->buffer, XXH3_BUFFER_STRIPES, ctx->secret);
+    bytes += nFillBytes;
+    nBytes -= nFillBytes;
+    ctx->nBufferedBytes = 0;
+  }
+
+  if (nBytes > HASH_XXH3_BUFFER_SIZE)
+  {
+    size_t nStripes = (nBytes - 1) / XXH3_STRIPE_SIZE;
+    size_t nConsumedBytes = nStripes * XXH3_STRIPE_SIZE;
+
+    Xxh3ConsumeStripes(ctx->acc, &ctx->nStripesInBlock, bytes, nStripes, ctx->secret);
+    memcpy(&ctx->buffer[HASH_XXH3_BUFFER_SIZE - XXH3_STRIPE_SIZE], &bytes[nConsumedBytes - XXH3_STRIPE_SIZE],
+           XXH3_STRIPE_SIZE);
+    bytes += nConsumedBytes;
+    nBytes -= nConsumedBytes;
+  }
+
+  memcpy(ctx->buffer, bytes, nBytes);
+  ctx->nBufferedBytes = nBytes;
+}
+
+uint64_t HASH_Ctx64Final(HASH_Ctx64_T const * const ctx)
+{
+  uint64_t acc[8];
+  uint8_t lastStripe[XXH3_STRIPE_SIZE];
+  uint8_t const *pLastStripe = lastStripe;
+
+  if (ctx->totalBytes <= XXH3_MIDSIZE_MAX)
+  {
+    return HASH_Calc64(ctx->buffer, (size_t)ctx->totalBytes, ctx->seed);
+  }
+
+  memcpy(acc, ctx->acc, sizeof(acc));
+
+  if (ctx->nBufferedBytes >= XXH3_STRIPE_SIZE)
+  {
+    size_t nStripesInBlock = ctx->nStripesInBlock;
+
+    Xxh3ConsumeStripes(acc, &nStripesInBlock, ctx->buffer, (ctx->nBufferedBytes - 1) / XXH3_STRIPE_SIZE,
+                       ctx->secret);
+    pLastStripe = &ctx->buffer[ctx->nBufferedBytes - XXH3_STRIPE_SIZE];
+  }
+  else
+  {
+    /* Last stripe overlaps with previously processed data kept at the buffer end */
+    size_t nPreviousBytes = XXH3_STRIPE_SIZE - ctx->nBufferedBytes;
+
+    memcpy(lastStripe, &ctx->buffer[HASH_XXH3_BUFFER_SIZE - nPreviousBytes], nPreviousBytes);
+    memcpy(&lastStripe[nPreviousBytes], ctx->buffer, ctx->nBufferedBytes);
+  }
+
+  Xxh3Accumulate(acc, pLastStripe, &ctx->secret[XXH3_SECRET_LIMIT - XXH3_SECRET_LASTACC_START], 1);
+
+  return Xxh3MergeAccs(acc, &ctx->secret[XXH3_SECRET_MERGEACCS_START], ctx->totalBytes * XXH_PRIME64_1);
+}
+
+/*======================================================================================*/
+/*                   ####### LOCAL FUNCTIONS DEFINITIONS #######                        */
+/*======================================================================================*/
+static inline uint32_t ReadUint32LE(uint8_t const *bytes)
+{
+  uint32_t value;
+
+  memcpy(&value, bytes, sizeof(value));
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+  value = SWAP_BYTES32(value);
+#endif
+
+  return value;
+}
+
+static inline uint64_t ReadUint64LE(uint8_t const *bytes)
+{
+  uint64_t value;
+
+  memcpy(&value, bytes, sizeof(value));
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+  value = SWAP_BYTES64(value);
+#endif
+
+  return value;
+}
+
+static inline void WriteUint64LE(uint8_t *bytes, uint64_t value)
+{
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+  value = SWAP_BYTES64(value);
+#endif
+  memcpy(bytes, &value, sizeof(value));
+}
+
+/** Multiplies two 64 bits values into 128 bits product and returns XOR of its halves */
+static inline uint64_t Mul128Fold64(uint64_t a, uint64_t b)
+{
+#ifdef __SIZEOF_INT128__
+  unsigned __int128 product = (unsigned __int128)a * b;
+
+  return ((uint64_t)product ^ (uint64_t)(product >> 64));
+#else
+  uint64_t loLo = (a & 0xFFFFFFFF) * (b & 0xFFFFFFFF);
+  uint64_t hiLo = (a >> 32) * (b & 0xFFFFFFFF);
+  uint64_t loHi = (a & 0xFFFFFFFF) * (b >> 32);
+  uint64_t hiHi = (a >> 32) * (b >> 32);
+  uint64_t cross = (loLo >> 32) + (hiLo & 0xFFFFFFFF) + loHi;
+  uint64_t high = (hiLo >> 32) + (cross >> 32) + hiHi;
+  uint64_t low = (cross << 32) | (loLo & 0xFFFFFFFF);
+
+  return (low ^ high);
+#endif
+}
+
+static inline uint32_t Xxh32Round(uint32_t lane, uint32_t input)
+{
+  lane += input * XXH_PRIME32_2;
+  VECTORIZATION_BARRIER(lane);
+  lane = ROTL32(lane, 13);
+
+  return (lane * XXH_PRIME32_1);
+}
+
+static void Xxh32InitLanes(uint32_t lanes[4], uint32_t seed)
+{
+  lanes[0] = seed + XXH_PRIME32_1 + XXH_PRIME32_2;
+  lanes[1] = seed + XXH_PRIME32_2;
+  lanes[2] = seed;
+  lanes[3] = seed - XXH_PRIME32_1;
+}
+
+static void Xxh32ProcessStripes(uint32_t lanes[4], uint8_t const *data, size_t nStripes)
+{
+  uint32_t lane0 = lanes[0];
+  uint32_t lane1 = lanes[1];
+  uint32_t lane2 = lanes[2];
+  uint32_t lane3 = lanes[3];
+
+  for (size_t stripe = 0; stripe < nStripes; stripe++)
+  {
+    lane0 = Xxh32Round(lane0, ReadUint32LE(&data[0]));
+    lane1 = Xxh32Round(lane1, ReadUint32LE(&data[4]));
+    lane2 = Xxh32Round(lane2, ReadUint32LE(&data[8]));
+    lane3 = Xxh32Round(lane3, ReadUint32LE(&data[12]));
+    data += XXH32_STRIPE_SIZE;
+  }
+
+  lanes[0] = lane0;
+  lanes[1] = lane1;
+  lanes[2] = lane2;
+  lanes[3] = lane3;
+}
+
+static uint32_t Xxh32MergeLanes(uint32_t const lanes[4])
+{
+  return (ROTL32(lanes[0], 1) + ROTL32(lanes[1], 7) + ROTL32(lanes[2], 12) + ROTL32(lanes[3], 18));
+}
+
+/** Mixes bytes of not complete stripe into hash and avalanches the result */
+static uint32_t Xxh32Finalize(uint32_t hash, uint8_t const *data, size_t nBytes)
+{
+  for (; nBytes >= 4; nBytes -= 4)
+  {
+    hash += ReadUint32LE(data) * XXH_PRIME32_3;
+    hash = ROTL32(hash, 17) * XXH_PRIME32_4;
+    data += 4;
+  }
+
+  for (; nBytes > 0; nBytes--)
+  {
+    hash += (*data++) * XXH_PRIME32_5;
+    hash = ROTL32(hash, 11) * XXH_PRIME32_1;
+  }
+
+  hash ^= hash >> 15;
+  hash *= XXH_PRIME32_2;
+  hash ^= hash >> 13;
+  hash *= XXH_PRIME32_3;
+  hash ^= hash >> 16;
+
+  return hash;
+}
+
+static inline uint64_t Xxh64Avalanche(uint64_t hash)
+{
+  hash ^= hash >> 33;
+  hash *= XXH_PRIME64_2;
+  hash ^= hash >> 29;
+  hash *= XXH_PRIME64_3;
+  hash ^= hash >> 32;
+
+  return hash;
+}
+
+static inline uint64_t Xxh3Avalanche(uint64_t hash)
+{
+  hash ^= hash >> 37;
+  hash *= 0x165667919E3779F9ULL;
+  hash ^= hash >> 32;
+
+  return hash;
+}
+
+static inline uint64_t Xxh3Mix16(uint8_t const *data, uint8_t const *secret, uint64_t seed)
+{
+  return Mul128Fold64(ReadUint64LE(data) ^ (ReadUint64LE(secret) + seed),
+                      ReadUint64LE(&data[8]) ^ (ReadUint64LE(&secret[8]) - seed));
+}
+
+/* Keys up to 16 bytes are read with at most two overlapping loads, without any loop */
+static uint64_t Xxh3Len0To16(uint8_t const *data, size_t nBytes, uint64_t seed)
+{
+  uint8_t const *secret = Xxh3DefaultSecret;
+
+  if (nBytes > 8)
+  {
+    uint64_t low = ReadUint64LE(data) ^ ((ReadUint64LE(&secret[24]) ^ ReadUint64LE(&secret[32])) + seed);
+    uint64_t high = ReadUint64LE(&data[nBytes - 8]) ^ ((ReadUint64LE(&secret[40]) ^ ReadUint64LE(&secret[48])) - seed);
+    uint64_t acc = nBytes + SWAP_BYTES64(low) + high + Mul128Fold64(low, high);
+
+    return Xxh3Avalanche(acc);
+  }
+  else if (nBytes >= 4)
+  {
+    uint64_t input;
+    uint64_t hash;
+
+    seed ^= (uint64_t)SWAP_BYTES32((uint32_t)seed) << 32;
+    input = ReadUint32LE(&data[nBytes - 4]) + ((uint64_t)ReadUint32LE(data) << 32);
+    hash = input ^ ((ReadUint64LE(&secret[8]) ^ ReadUint64LE(&secret[16])) - seed);
+
+    hash ^= ROTL64(hash, 49) ^ ROTL64(hash, 24);
+    hash *= 0x9FB21C651E98DF25ULL;
+    hash ^= (hash >> 35) + nBytes;
+    hash *= 0x9FB21C651E98DF25ULL;
+    hash ^= hash >> 28;
+
+    return hash;
+  }
+  else if (nBytes > 0)
+  {
+    uint32_t combined = ((uint32_t)data[0] << 16) | ((uint32_t)data[nBytes >> 1] << 24) | data[nBytes - 1]
+                        | ((uint32_t)nBytes << 8);
+
+    return Xxh64Avalanche(combined ^ ((uint64_t)(ReadUint32LE(secret) ^ ReadUint32LE(&secret[4])) + seed));
+  }
+  else
+  {
+    return Xxh64Avalanche(seed ^ ReadUint64LE(&secret[56]) ^ ReadUint64LE(&secret[64]));
+  }
+}
+
+static uint64_t Xxh3Len17To128(uint8_t const *data, size_t nBytes, uint64_t seed)
+{
+  uint8_t const *secret = Xxh3DefaultSecret;
+  uint64_t acc = nBytes * XXH_PRIME64_1;
+
+  if (nBytes > 32)
+  {
+    if (nBytes > 64)
+    {
+      if (nBytes > 96)
+      {
+        acc += Xxh3Mix16(&data[48], &secret[96], seed);
+        acc += Xxh3Mix16(&data[nBytes - 64], &secret[112], seed);
+      }
+
+      acc += Xxh3Mix16(&data[32], &secret[64], seed);
+      acc += Xxh3Mix16(&data[nBytes - 48], &secret[80], seed);
+    }
+
+    acc += Xxh3Mix16(&data[16], &secret[32], seed);
+    acc += Xxh3Mix16(&data[nBytes - 32], &secret[48], seed);
+  }
+
+  acc += Xxh3Mix16(data, secret, seed);
+  acc += Xxh3Mix16(&data[nBytes - 16], &secret[16], seed);
+
+  return Xxh3Avalanche(acc);
+}
+
+static uint64_t Xxh3Len129To240(uint8_t const *data, size_t nBytes, uint64_t seed)
+{
+  uint8_t const *secret = Xxh3DefaultSecret;
+  uint64_t acc = nBytes * XXH_PRIME64_1;
+  size_t nRounds = nBytes / 16;
+  size_t round;
+
+  for (round = 0; round < 8; round++)
+  {
+    acc += Xxh3Mix16(&data[16 * round], &secret[16 * round], seed);
+  }
+
+  acc = Xxh3Avalanche(acc);
+
+  for (; round < nRounds; round++)
+  {
+    acc += Xxh3Mix16(&data[16 * round], &secret[16 * (round - 8) + XXH3_MIDSIZE_START_OFFSET], seed);
+  }
+
+  acc += Xxh3Mix16(&data[nBytes - 16], &secret[XXH3_SECRET_SIZE_MIN - XXH3_MIDSIZE_LAST_OFFSET], seed);
+
+  return Xxh3Avalanche(acc);
+}
+
+static void Xxh3InitSecret(uint8_t secret[HASH_XXH3_SECRET_SIZE], uint64_t seed)
+{
+  for (size_t offset = 0; offset < HASH_XXH3_SECRET_SIZE; offset += 16)
+  {
+    WriteUint64LE(&secret[offset], ReadUint64LE(&Xxh3DefaultSecret[offset]) + seed);
+    WriteUint64LE(&secret[offset + 8], ReadUint64LE(&Xxh3DefaultSecret[offset + 8]) - seed);
+  }
+}
+
+/**
+ * @brief   Accumulates stripes of data, the key moves by 8 bytes of secret for every stripe.
+ * @param   [in,out] acc        is array of accumulators
+ * @param   [in] data           is pointer to stripes
+ * @param   [in] secret         is pointer to key of the first stripe
+ * @param   [in] nStripes       is number of stripes
+ */
+static void Xxh3Accumulate(uint64_t acc[8], uint8_t const *data, uint8_t const *secret, size_t nStripes)
+{
+  if (NULL != Kernels.xxh3Accumulate)
+  {
+    Kernels.xxh3Accumulate(acc, data, secret, nStripes);
+    return;
+  }
+
+  for (size_t stripe = 0; stripe < nStripes; stripe++)
+  {
+    for (uint8_t idx = 0; idx < 8; idx++)
+    {
+      uint64_t value = ReadUint64LE(&data[8 * idx]);
+      uint64_t keyed = value ^ ReadUint64LE(&secret[8 * idx]);
+
+      acc[idx ^ 1] += value;
+      acc[idx] += (keyed & 0xFFFFFFFF) * (keyed >> 32);
+    }
+
+    data += XXH3_STRIPE_SIZE;
+    secret += XXH3_SECRET_CONSUME_RATE;
+  }
+}
+
+static void Xxh3Scramble(uint64_t acc[8], uint8_t const *secret)
+{
+  if (NULL != Kernels.xxh3Scramble)
+  {
+    Kernels.xxh3Scramble(acc, secret);
+    return;
+  }
+
+  for (uint8_t idx = 0; idx < 8; idx++)
+  {
+    acc[idx] ^= acc[idx] >> 47;
+    acc[idx] ^= ReadUint64LE(&secret[8 * idx]);
+    acc[idx] *= XXH_PRIME32_1;
+  }
+}
+
+/**
+ * @brief   Accumulates stripes continuing the current block, accumulators are scrambled at every block end.
+ * @param   [in,out] acc                is array of accumulators
+ * @param   [in,out] nStripesInBlock    is number of stripes already accumulated in the current block
+ * @param   [in] data                   is pointer to stripes
+ * @param   [in] nStripes               is number of stripes
+ * @param   [in] secret                 is pointer to secret
+ */
+static void Xxh3ConsumeStripes(uint64_t acc[8], size_t *nStripesInBlock, uint8_t const *data, size_t nStripes,
+                               uint8_t const *secret)
+{
+  while (*nStripesInBlock + nStripes >= XXH3_STRIPES_PER_BLOCK)
+  {
+    size_t nBlockStripes = XXH3_STRIPES_PER_BLOCK - *nStripesInBlock;
+
+    Xxh3Accumulate(acc, data, &secret[*nStripesInBlock * XXH3_SECRET_CONSUME_RATE], nBlockStripes);
+    Xxh3Scramble(acc, &secret[XXH3_SECRET_LIMIT]);
+    data += nBlockStripes * XXH3_STRIPE_SIZE;
+    nStripes -= nBlockStripes;
+    *nStripesInBlock = 0;
+  }
+
+  Xxh3Accumulate(acc, data, &secret[*nStripesInBlock * XXH3_SECRET_CONSUME_RATE], nStripes);
+  *nStripesInBlock += nStripes;
+}
+
+static uint64_t Xxh3MergeAccs(uint64_t const acc[8], uint8_t const *secret, uint64_t start)
+{
+  uint64_t result = start;
+
+  for (uint8_t idx = 0; idx < 4; idx++)
+  {
+    result += Mul128Fold64(acc[2 * idx] ^ ReadUint64LE(&secret[16 * idx]),
+                           acc[2 * idx + 1] ^ ReadUint64LE(&secret[16 * idx + 8]));
+  }
+
+  return Xxh3Avalanche(result);
+}
+
+static uint64_t Xxh3HashLong(uint8_t const *data, size_t nBytes, uint8_t const *secret)
+{
+  uint64_t acc[8];
+  size_t nBlocks = (nBytes - 1) / XXH3_BLOCK_SIZE;
+  size_t nStripes = ((nBytes - 1) - nBlocks * XXH3_BLOCK_SIZE) / XXH3_STRIPE_SIZE;
+
+  memcpy(acc, Xxh3InitialAcc, sizeof(acc));
+
+  for (size_t block = 0; block < nBlocks; block++)
+  {
+    Xxh3Accumulate(acc, &data[block * XXH3_BLOCK_SIZE], secret, XXH3_STRIPES_PER_BLOCK);
+    Xxh3Scramble(acc, &secret[XXH3_SECRET_LIMIT]);
+  }
+
+  Xxh3Accumulate(acc, &data[nBlocks * XXH3_BLOCK_SIZE], secret, nStripes);
+  Xxh3Accumulate(acc, &data[nBytes - XXH3_STRIPE_SIZE], &secret[XXH3_SECRET_LIMIT - XXH3_SECRET_LASTACC_START], 1);
+
+  return Xxh3MergeAccs(acc, &secret[XXH3_SECRET_MERGEACCS_START], nBytes * XXH_PRIME64_1);
+}
+
+#ifdef HASH_SIMD_ENABLED
+__attribute__((target("sse2")))
+static void Xxh3AccumulateSse2(uint64_t acc[8], uint8_t const *data, uint8_t const *secret, size_t nStripes)
+{
+  __m128i accVector[4];
+
+  for (uint8_t idx = 0; idx < 4; idx++)
+  {
+    accVector[idx] = _mm_loadu_si128((__m128i const*)&acc[2 * idx]);
+  }
+
+  for (size_t stripe = 0; stripe < nStripes; stripe++)
+  {
+    for (uint8_t idx = 0; idx < 4; idx++)
+    {
+      __m128i value = _mm_loadu_si128((__m128i const*)&data[16 * idx]);
+      __m128i keyed = _mm_xor_si128(value, _mm_loadu_si128((__m128i const*)&secret[16 * idx]));
+      __m128i product = _mm_mul_epu32(keyed, _mm_shuffle_epi32(keyed, _MM_SHUFFLE(0, 3, 0, 1)));
+
+      accVector[idx] = _mm_add_epi64(accVector[idx], _mm_shuffle_epi32(value, _MM_SHUFFLE(1, 0, 3, 2)));
+      accVector[idx] = _mm_add_epi64(accVector[idx], product);
+    }
+
+    data += XXH3_STRIPE_SIZE;
+    secret += XXH3_SECRET_CONSUME_RATE;
+  }
+
+  for (uint8_t idx = 0; idx < 4; idx++)
+  {
+    _mm_storeu_si128((__m128i*)&acc[2 * idx], accVector[idx]);
+  }
+}
+
+__attribute__((target("avx2")))
+static void Xxh3AccumulateAvx2(uint64_t acc[8], uint8_t const *data, uint8_t const *secret, size_t nStripes)
+{
+  __m256i accVector[2];
+
+  for (uint8_t idx = 0; idx < 2; idx++)
+  {
+    accVector[idx] = _mm256_loadu_si256((__m256i const*)&acc[4 * idx]);
+  }
+
+  for (size_t stripe = 0; stripe < nStripes; stripe++)
+  {
+    for (uint8_t idx = 0; idx < 2; idx++)
+    {
+      __m256i value = _mm256_loadu_si256((__m256i const*)&data[32 * idx]);
+      __m256i keyed = _mm256_xor_si256(value, _mm256_loadu_si256((__m256i const*)&secret[32 * idx]));
+      __m256i product = _mm256_mul_epu32(keyed, _mm256_shuffle_epi32(keyed, _MM_SHUFFLE(0, 3, 0, 1)));
+
+      accVector[idx] = _mm256_add_epi64(accVector[idx], _mm256_shuffle_epi32(value, _MM_SHUFFLE(1, 0, 3, 2)));
+      accVector[idx] = _mm256_add_epi64(accVector[idx], product);
+    }
+
+    data += XXH3_STRIPE_SIZE;
+    secret += XXH3_SECRET_CONSUME_RATE;
+  }
+
+  for (uint8_t idx = 0; idx < 2; idx++)
+  {
+    _mm256_storeu_si256((__m256i*)&acc[4 * idx], accVector[idx]);
+  }
+}
+
+/* 64 bits multiplication by 32 bits prime is composed of two 32x32 bits multiplications */
+__attribute__((target("sse2")))
+static void Xxh3ScrambleSse2(uint64_t acc[8], uint8_t const *secret)
+{
+  const __m128i prime = _mm_set1_epi32((int32_t)XXH_PRIME32_1);
+
+  for (uint8_t idx = 0; idx < 4; idx++)
+  {
+    __m128i accVector = _mm_loadu_si128((__m128i const*)&acc[2 * idx]);
+    __m128i low;
+    __m128i high;
+
+    accVector = _mm_xor_si128(accVector, _mm_srli_epi64(accVector, 47));
+    accVector = _mm_xor_si128(accVector, _mm_loadu_si128((__m128i const*)&secret[16 * idx]));
+    low = _mm_mul_epu32(accVector, prime);
+    high = _mm_mul_epu32(_mm_shuffle_epi32(accVector, _MM_SHUFFLE(0, 3, 0, 1)), prime);
+    _mm_storeu_si128((__m128i*)&acc[2 * idx], _mm_add_epi64(low, _mm_slli_epi64(high, 32)));
+  }
+}
+
+__attribute__((target("avx2")))
+static void Xxh3ScrambleAvx2(uint64_t acc[8], uint8_t const *secret)
+{
+  const __m256i prime = _mm256_set1_epi32((int32_t)XXH_PRIME32_1);
+
+  for (uint8_t idx = 0; idx < 2; idx++)
+  {
+    __m256i accVector = _mm256_loadu_si256((__m256i const*)&acc[4 * idx]);
+    __m256i low;
+    __m256i high;
+
+    accVector = _mm256_xor_si256(accVector, _mm256_srli_epi64(accVector, 47));
+    accVector = _mm256_xor_si256(accVector, _mm256_loadu_si256((__m256i const*)&secret[32 * idx]));
+    low = _mm256_mul_epu32(accVector, prime);
+    high = _mm256_mul_epu32(_mm256_shuffle_epi32(accVector, _MM_SHUFFLE(0, 3, 0, 1)), prime);
+    _mm256_storeu_si256((__m256i*)&acc[4 * idx], _mm256_add_epi64(low, _mm256_slli_epi64(high, 32)));
+  }
+}
+#endif
+
+#ifdef CPUF_RESOLVER
+CPUF_RESOLVER static void ResolveKernels(void)
+{
+  if (true == CPUF_IsSupported(CPUF_FEATURE_AVX2))
+  {
+    Kernels.xxh3Accumulate = Xxh3AccumulateAvx2;
+    Kernels.xxh3Scramble = Xxh3ScrambleAvx2;
+  }
+  else if (true == CPUF_IsSupported(CPUF_FEATURE_SSE2))
+  {
+    Kernels.xxh3Accumulate = Xxh3AccumulateSse2;
+    Kernels.xxh3Scramble = Xxh3ScrambleSse2;
+  }
+}
+#endif
+
+/**
+ * @}
+ */
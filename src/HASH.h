@@ -0,0 +1,159 @@
+/*=======================================================================================*
+ * @file    HASH.h
+ * @author  Damian Pala
+ * @date    18-10-2026
+ * @brief   Header file for HASH module
+ *
+ *          This file contains API of HASH module
+ *======================================================================================*/
+/*----------------------- DEFINE TO PREVENT RECURSIVE INCLUSION ------------------------*/
+#ifndef HASH_H_
+#define HASH_H_
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/**
+ * @addtogroup HASH Description
+ * @{
+ * @brief Module for non-cryptographic hashing of keys and buffers.
+ *
+ *        32 bits hash is XXH32, it needs only 32 bits multiplications, so it is the right choice for
+ *        small microcontrollers. 64 bits hash is XXH3-64, it is vectorized for long data and has
+ *        dedicated paths for keys up to 16 bytes. Results are equal to the reference xxHash library
+ *        of the same seed, on any endianness. Hashes must not be used where an attacker controls keys.
+ */
+
+/*======================================================================================*/
+/*                       ####### PREPROCESSOR DIRECTIVES #######                        */
+/*======================================================================================*/
+/*-------------------------------- INCLUDE DIRECTIVES ----------------------------------*/
+#include <stdint.h>
+#include <stddef.h>
+
+/*----------------------------- LOCAL OBJECT-LIKE MACROS -------------------------------*/
+#define HASH_XXH3_SECRET_SIZE         192   ///< Size in bytes of XXH3 secret derived from seed
+#define HASH_XXH3_BUFFER_SIZE         256   ///< Size in bytes of XXH3 streaming buffer, 4 stripes
+
+/*---------------------------- LOCAL FUNCTION-LIKE MACROS ------------------------------*/
+
+/*======================================================================================*/
+/*                     ####### EXPORTED TYPE DECLARATIONS #######                       */
+/*======================================================================================*/
+/*-------------------------------- OTHER TYPEDEFS --------------------------------------*/
+
+/*------------------------------------- ENUMS ------------------------------------------*/
+
+/*------------------------------- STRUCT AND UNIONS ------------------------------------*/
+/** 32 bits hash calculation context, each hashed stream needs its own context */
+typedef struct HASH_Ctx32_Tag
+{
+  uint32_t seed;                ///< Seed of the hash
+  uint32_t lanes[4];            ///< Accumulators of 16 bytes stripes
+  uint64_t totalBytes;          ///< Length of data processed so far
+  uint8_t buffer[16];           ///< Bytes of not complete stripe
+  uint8_t nBufferedBytes;       ///< Number of bytes in buffer
+} HASH_Ctx32_T;
+
+/** 64 bits hash calculation context, each hashed stream needs its own context */
+typedef struct HASH_Ctx64_Tag
+{
+  uint64_t seed;                ///< Seed of the hash
+  uint64_t acc[8];              ///< Accumulators of 64 bytes stripes
+  uint64_t totalBytes;          ///< Length of data processed so far
+  size_t nStripesInBlock;       ///< Number of stripes accumulated since last scrambling
+  size_t nBufferedBytes;        ///< Number of bytes in buffer
+  uint8_t secret[HASH_XXH3_SECRET_SIZE]; ///< Secret derived from seed
+  uint8_t buffer[HASH_XXH3_BUFFER_SIZE]; ///< Not processed bytes, the end keeps last processed stripe
+} HASH_Ctx64_T;
+
+/*======================================================================================*/
+/*                    ####### EXPORTED OBJECT DECLARATIONS #######                      */
+/*======================================================================================*/
+
+/*======================================================================================*/
+/*                   ####### EXPORTED FUNCTIONS PROTOTYPES #######                      */
+/*======================================================================================*/
+/**
+ * @brief   This function calculates 32 bits hash (XXH32) of data.
+ * @param   [in] data       is pointer to data
+ * @param   [in] nBytes     is data length in bytes
+ * @param   [in] seed       is seed, different seeds give independent hashes
+ * @return  Hash value.
+ */
+uint32_t HASH_Calc32(void const *data, size_t nBytes, uint32_t seed);
+
+
+/**
+ * @brief   This function calculates 64 bits hash (XXH3-64) of data.
+ * @param   [in] data       is pointer to data
+ * @param   [in] nBytes     is data length in bytes
+ * @param   [in] seed       is seed, different seeds give independent hashes
+ * @return  Hash value.
+ */
+uint64_t HASH_Calc64(void const *data, size_t nBytes, uint64_t seed);
+
+
+/**
+ * @brief   This function initializes 32 bits hash calculation context.
+ * @param   [out] ctx       is pointer to context
+ * @param   [in] seed       is seed of the hash
+ */
+void HASH_Ctx32Init(HASH_Ctx32_T * const ctx, uint32_t seed);
+
+
+/**
+ * @brief   This function updates 32 bits hash calculation context with next part of data.
+ * @param   [in,out] ctx    is pointer to context initialized by #HASH_Ctx32Init
+ * @param   [in] data       is pointer to data
+ * @param   [in] nBytes     is data length in bytes
+ */
+void HASH_Ctx32Update(HASH_Ctx32_T * const ctx, void const *data, size_t nBytes);
+
+
+/**
+ * @brief   This function returns 32 bits hash of all data passed to context, context is not modified.
+ * @param   [in] ctx        is pointer to context
+ * @return  Hash value, equal to #HASH_Calc32 of the concatenated data.
+ */
+uint32_t HASH_Ctx32Final(HASH_Ctx32_T const * const ctx);
+
+
+/**
+ * @brief   This function initializes 64 bits hash calculation context.
+ * @param   [out] ctx       is pointer to context
+ * @param   [in] seed       is seed of the hash
+ */
+void HASH_Ctx64Init(HASH_Ctx64_T * const ctx, uint64_t seed);
+
+
+/**
+ * @brief   This function updates 64 bits hash calculation context with next part of data.
+ * @param   [in,out] ctx    is pointer to context initialized by #HASH_Ctx64Init
+ * @param   [in] data       is pointer to data
+ * @param   [in] nBytes     is data length in bytes
+ */
+void HASH_Ctx64Update(HASH_Ctx64_T * const ctx, void const *data, size_t nBytes);
+
+
+/**
+ * @brief   This function returns 64 bits hash of all data passed to context, context is not modified.
+ * @param   [in] ctx        is pointer to context
+ * @return  Hash value, equal to #HASH_Calc64 of the concatenated data.
+ */
+uint64_t HASH_Ctx64Final(HASH_Ctx64_T const * const ctx);
+
+/*======================================================================================*/
+/*                          ####### INLINE FUNCTIONS #######                            */
+/*======================================================================================*/
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HASH_H_ */
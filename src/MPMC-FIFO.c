@@ -0,0 +1,164 @@
+/*=======================================================================================*
+ * @file    MPMC-FIFO.c
+ * @author  Damian Pala
+ * @date    18-10-2026
+ * @brief   This file contains all implementations for MPMC-FIFO module.
+ *======================================================================================*/
+
+/**
+ * @addtogroup MPMC-FIFO Lock-free Multi Producer Multi Consumer FIFO Queue
+ * @{
+ * @brief This module contains implementation of bounded lock-free MPMC FIFO.
+ */
+
+/*======================================================================================*/
+/*                       ####### PREPROCESSOR DIRECTIVES #######                        */
+/*======================================================================================*/
+/*-------------------------------- INCLUDE DIRECTIVES ----------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <stdatomic.h>
+
+#include "MPMC-FIFO.h"
+
+/*----------------------------- LOCAL OBJECT-LIKE MACROS -------------------------------*/
+
+/*---------------------------- LOCAL FUNCTION-LIKE MACROS ------------------------------*/
+
+/*======================================================================================*/
+/*                      ####### LOCAL TYPE DECLARATIONS #######                         */
+/*======================================================================================*/
+/*-------------------------------- OTHER TYPEDEFS --------------------------------------*/
+
+/*------------------------------------- ENUMS ------------------------------------------*/
+
+/*------------------------------- STRUCT AND UNIONS ------------------------------------*/
+
+/*======================================================================================*/
+/*                         ####### OBJECT DEFINITIONS #######                           */
+/*======================================================================================*/
+/*--------------------------------- EXPORTED OBJECTS -----------------------------------*/
+
+/*---------------------------------- LOCAL OBJECTS -------------------------------------*/
+
+/*======================================================================================*/
+/*                    ####### LOCAL FUNCTIONS PROTOTYPES #######                        */
+/*======================================================================================*/
+static inline uint32_t LoadSequence(MPMCFIFO_T const * const fifo, uint32_t slot);
+static inline void StoreSequence(MPMCFIFO_T * const fifo, uint32_t slot, uint32_t sequence);
+
+/*======================================================================================*/
+/*                   ####### LOCAL FUNCTIONS DEFINITIONS #######                        */
+/*======================================================================================*/
+/*
+ * Slot of position pos is free for producer when its sequence equals pos, and filled for consumer
+ * when its sequence equals pos + 1. Consumer frees slot for the producer of the next lap, pos + size.
+ */
+static inline uint32_t LoadSequence(MPMCFIFO_T const * const fifo, uint32_t slot)
+{
+  return atomic_load_explicit(&fifo->sequences[slot], memory_order_acquire) + slot;
+}
+
+static inline void StoreSequence(MPMCFIFO_T * const fifo, uint32_t slot, uint32_t sequence)
+{
+  atomic_store_explicit(&fifo->sequences[slot], sequence - slot, memory_order_release);
+}
+
+/*======================================================================================*/
+/*                  ####### EXPORTED FUNCTIONS DEFINITIONS #######                      */
+/*======================================================================================*/
+bool MPMCFIFO_PushItem(MPMCFIFO_T * const fifo, void const * const pToItem)
+{
+  uint32_t mask = (uint32_t)fifo->queueSizeInItems - 1;
+  uint32_t pos = atomic_load_explicit(&fifo->enqueuePos, memory_order_relaxed);
+  uint32_t slot;
+
+  for (;;)
+  {
+    int32_t diff;
+
+    slot = pos & mask;
+    diff = (int32_t)(LoadSequence(fifo, slot) - pos);
+
+    if (0 == diff)
+    {
+      /* On failure pos is updated to the current position */
+      if (true == atomic_compare_exchange_weak_explicit(&fifo->enqueuePos, &pos, pos + 1,
+                                                        memory_order_relaxed, memory_order_relaxed))
+      {
+        break;
+      }
+    }
+    else if (diff < 0)
+    {
+      /* Slot is not popped yet since the previous lap */
+      return false;
+    }
+    else
+    {
+      pos = atomic_load_explicit(&fifo->enqueuePos, memory_order_relaxed);
+    }
+  }
+
+  memcpy(&fifo->buffer[(size_t)slot * fifo->itemSize], pToItem, fifo->itemSize);
+  StoreSequence(fifo, slot, pos + 1);
+
+  return true;
+}
+
+bool MPMCFIFO_PopItem(MPMCFIFO_T * const fifo, void * const pToItem)
+{
+  uint32_t mask = (uint32_t)fifo->queueSizeInItems - 1;
+  uint32_t pos = atomic_load_explicit(&fifo->dequeuePos, memory_order_relaxed);
+  uint32_t slot;
+
+  for (;;)
+  {
+    int32_t diff;
+
+    slot = pos & mask;
+    diff = (int32_t)(LoadSequence(fifo, slot) - (pos + 1));
+
+    if (0 == diff)
+    {
+      if (true == atomic_compare_exchange_weak_explicit(&fifo->dequeuePos, &pos, pos + 1,
+                                                        memory_order_relaxed, memory_order_relaxed))
+      {
+        break;
+      }
+    }
+    else if (diff < 0)
+    {
+      /* Slot is not pushed yet */
+      return false;
+    }
+    else
+    {
+      pos = atomic_load_explicit(&fifo->dequeuePos, memory_order_relaxed);
+    }
+  }
+
+  memcpy(pToItem, &fifo->buffer[(size_t)slot * fifo->itemSize], fifo->itemSize);
+  StoreSequence(fifo, slot, pos + fifo->queueSizeInItems);
+
+  return true;
+}
+
+uint16_t MPMCFIFO_GetItemsInFifo(MPMCFIFO_T * const fifo)
+{
+  uint32_t dequeuePos = atomic_load_explicit(&fifo->dequeuePos, memory_order_relaxed);
+  uint32_t enqueuePos = atomic_load_explicit(&fifo->enqueuePos, memory_order_relaxed);
+  int32_t nItems = (int32_t)(enqueuePos - dequeuePos);
+
+  if (nItems < 0)
+  {
+    return 0;
+  }
+
+  return (nItems > fifo->queueSizeInItems) ? fifo->queueSizeInItems : (uint16_t)nItems;
+}
+
+/**
+ * @} end of group MPMC-FIFO Lock-free Multi Producer Multi Consumer FIFO Queue
+ */
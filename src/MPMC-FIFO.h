@@ -0,0 +1,136 @@
+/*=======================================================================================*
+ * @file    MPMC-FIFO.h
+ * @author  Damian Pala
+ * @date    18-10-2026
+ * @brief   Header file for MPMC-FIFO module
+ *
+ *          This file contains API of MPMC-FIFO module
+ *======================================================================================*/
+/*----------------------- DEFINE TO PREVENT RECURSIVE INCLUSION ------------------------*/
+#ifndef MPMC_FIFO_H_
+#define MPMC_FIFO_H_
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/**
+ * @addtogroup MPMC-FIFO Lock-free Multi Producer Multi Consumer FIFO Queue
+ * @{
+ * @brief MPMC-FIFO module contains bounded lock-free static FIFO queue shared by many producers and consumers.
+ *
+ *        Items have to be fixed size and size of queue has to be power of two. Every slot has sequence number,
+ *        which tells if the slot is free for the producer of given position or filled for the consumer of
+ *        given position. Producers and consumers claim positions by compare-and-swap, then they copy items
+ *        without any lock and publish slot by its sequence number. Queue never blocks, push to full queue and
+ *        pop from empty queue fail immediately. Module requires C11 atomics.
+ */
+
+/*======================================================================================*/
+/*                       ####### PREPROCESSOR DIRECTIVES #######                        */
+/*======================================================================================*/
+/*-------------------------------- INCLUDE DIRECTIVES ----------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+
+/*----------------------------- LOCAL OBJECT-LIKE MACROS -------------------------------*/
+#ifndef MPMCFIFO_CACHE_LINE_SIZE
+#define MPMCFIFO_CACHE_LINE_SIZE      64    ///< Enqueue and dequeue positions are kept in separate cache lines
+#endif
+
+/*---------------------------- LOCAL FUNCTION-LIKE MACROS ------------------------------*/
+/**
+ * @brief Macro function responsible for memory allocation, queue object and handle creation.
+ *
+ *        Sequence numbers are stored relative to slot index, so zeroed static memory is an empty queue.
+ * @param [in] name is the name of queue handle
+ * @param [in] item_size is the item size in bytes
+ * @param [in] queue_size_in_items is the size of queue counted in items, it has to be power of two
+ */
+#define MPMCFIFO_Create(name, item_size, queue_size_in_items) \
+  _Static_assert((0 != (queue_size_in_items)) && (0 == ((queue_size_in_items) & ((queue_size_in_items) - 1))), \
+                 "MPMC-FIFO size has to be power of two"); \
+  static uint8_t name ## _buffer[item_size * queue_size_in_items]; \
+  static _Atomic uint32_t name ## _sequences[queue_size_in_items]; \
+  static MPMCFIFO_T name ## _data = \
+  { \
+    0, \
+    0, \
+    name ## _sequences, \
+    name ## _buffer, \
+    item_size, \
+    queue_size_in_items \
+  }; \
+  static MPMCFIFO_T * name = &name ## _data;
+
+/*======================================================================================*/
+/*                     ####### EXPORTED TYPE DECLARATIONS #######                       */
+/*======================================================================================*/
+/*-------------------------------- OTHER TYPEDEFS --------------------------------------*/
+
+/*------------------------------------- ENUMS ------------------------------------------*/
+
+/*------------------------------- STRUCT AND UNIONS ------------------------------------*/
+/** FIFO structure definition */
+typedef struct MPMCFIFO_Tag
+{
+  _Alignas(MPMCFIFO_CACHE_LINE_SIZE) _Atomic uint32_t enqueuePos; ///< Position of next pushed item
+  _Alignas(MPMCFIFO_CACHE_LINE_SIZE) _Atomic uint32_t dequeuePos; ///< Position of next popped item
+  _Alignas(MPMCFIFO_CACHE_LINE_SIZE) _Atomic uint32_t *sequences; ///< Sequence numbers of slots minus slot index
+  uint8_t *buffer;              ///< Queue buffer
+  uint16_t itemSize;            ///< Item size in bytes
+  uint16_t queueSizeInItems;    ///< Queue size in items, power of two
+} MPMCFIFO_T;
+
+/*======================================================================================*/
+/*                    ####### EXPORTED OBJECT DECLARATIONS #######                      */
+/*======================================================================================*/
+
+/*======================================================================================*/
+/*                   ####### EXPORTED FUNCTIONS PROTOTYPES #######                      */
+/*======================================================================================*/
+/**
+ * @brief   This function pushes item into queue, it may be called by many threads at once.
+ * @param   [in] fifo       is queue handle equals name of created FIFO queue
+ * @param   [in] pToItem    is pointer to pushed item
+ * @return  Result of the pushing operation.
+ * @retval  true if item pushed properly
+ * @retval  false if queue is full
+ */
+bool MPMCFIFO_PushItem(MPMCFIFO_T * const fifo, void const * const pToItem);
+
+
+/**
+ * @brief   This function pops item from queue, it may be called by many threads at once.
+ * @param   [in] fifo       is queue handle equals name of created FIFO queue
+ * @param   [out] pToItem   is pointer to place where popped item should be written
+ * @return  Result of the popping operation.
+ * @retval  true if item popped properly
+ * @retval  false if queue is empty
+ */
+bool MPMCFIFO_PopItem(MPMCFIFO_T * const fifo, void * const pToItem);
+
+
+/**
+ * @brief   This function returns number of items in queue, it may be outdated when other threads work.
+ *
+ *          Items which are being pushed or popped at the moment are counted too.
+ * @param   [in] fifo       is queue handle equals name of created FIFO queue
+ * @return  Number of items in queue.
+ */
+uint16_t MPMCFIFO_GetItemsInFifo(MPMCFIFO_T * const fifo);
+
+/*======================================================================================*/
+/*                          ####### INLINE FUNCTIONS #######                            */
+/*======================================================================================*/
+
+/**
+ * @} end of group MPMC-FIFO Lock-free Multi Producer Multi Consumer FIFO Queue
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MPMC_FIFO_H_ */
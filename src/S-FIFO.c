@@ -17,6 +17,7 @@
 /*-------------------------------- INCLUDE DIRECTIVES ----------------------------------*/
 #include <stdint.h>
 #include <stdbool.h>
+#include <string.h>
 
 #include "S-FIFO.h"
 
@@ -45,6 +46,9 @@
 /*======================================================================================*/
 static inline bool ShouldHeadBeWraparound(SFIFO_T * const fifo);
 static inline void ShouldTailBeWraparound(SFIFO_T * const fifo);
+static inline uint16_t GetIndexAfter(SFIFO_T const * const fifo, uint16_t index, uint32_t nItems);
+static void CopyToBuffer(SFIFO_T * const fifo, uint16_t index, uint8_t const *pToItems, uint16_t nItems);
+static void CopyFromBuffer(SFIFO_T const * const fifo, uint16_t index, uint8_t *pToItems, uint16_t nItems);
 
 /*======================================================================================*/
 /*                   ####### LOCAL FUNCTIONS DEFINITIONS #######                        */
@@ -78,6 +82,44 @@ static inline void ShouldTailBeWraparound(SFIFO_T * const fifo)
   }
 }
 
+static inline uint16_t GetIndexAfter(SFIFO_T const * const fifo, uint16_t index, uint32_t nItems)
+{
+  return (uint16_t)((index + nItems) % fifo->queueSizeInItems);
+}
+
+/* Items from index to the end of buffer are copied first, the rest from the beginning */
+static void CopyToBuffer(SFIFO_T * const fifo, uint16_t index, uint8_t const *pToItems, uint16_t nItems)
+{
+  uint16_t nFirstItems = fifo->queueSizeInItems - index;
+  size_t nFirstBytes;
+
+  if (nFirstItems > nItems)
+  {
+    nFirstItems = nItems;
+  }
+
+  nFirstBytes = (size_t)nFirstItems * fifo->itemSize;
+
+  memcpy(&fifo->buffer[(size_t)index * fifo->itemSize], pToItems, nFirstBytes);
+  memcpy(fifo->buffer, &pToItems[nFirstBytes], (size_t)(nItems - nFirstItems) * fifo->itemSize);
+}
+
+static void CopyFromBuffer(SFIFO_T const * const fifo, uint16_t index, uint8_t *pToItems, uint16_t nItems)
+{
+  uint16_t nFirstItems = fifo->queueSizeInItems - index;
+  size_t nFirstBytes;
+
+  if (nFirstItems > nItems)
+  {
+    nFirstItems = nItems;
+  }
+
+  nFirstBytes = (size_t)nFirstItems * fifo->itemSize;
+
+  memcpy(pToItems, &fifo->buffer[(size_t)index * fifo->itemSize], nFirstBytes);
+  memcpy(&pToItems[nFirstBytes], fifo->buffer, (size_t)(nItems - nFirstItems) * fifo->itemSize);
+}
+
 /*======================================================================================*/
 /*                  ####### EXPORTED FUNCTIONS DEFINITIONS #######                      */
 /*======================================================================================*/
@@ -103,10 +145,7 @@ bool SFIFO_PushItem(SFIFO_T * const fifo, void const * const pToItem)
 
     offset = fifo->head * fifo->itemSize;
 
-    for (uint16_t byteCnt = 0; byteCnt < fifo->itemSize; byteCnt++)
-    {
-      fifo->buffer[offset + byteCnt] = ((uint8_t*)pToItem)[byteCnt];
-    }
+    memcpy(&fifo->buffer[offset], pToItem, fifo->itemSize);
 
     if ((true == SFIFO_IsFull(fifo)) && (true == fifo->overwriteLastItems))
     {
@@ -138,10 +177,7 @@ bool SFIFO_PopItem(SFIFO_T * const fifo, void * const pToItem)
   {
     uint16_t offset = fifo->tail * fifo->itemSize;
 
-    for (uint16_t byteCnt = 0; byteCnt < fifo->itemSize; byteCnt++)
-    {
-      ((uint8_t*)pToItem)[byteCnt] = fifo->buffer[offset + byteCnt];
-    }
+    memcpy(pToItem, &fifo->buffer[offset], fifo->itemSize);
 
     fifo->tail++;
 
@@ -170,6 +206,153 @@ bool SFIFO_PopItem(SFIFO_T * const fifo, void * const pToItem)
   return ret;
 }
 
+uint16_t SFIFO_PushItems(SFIFO_T * const fifo, void const * const pToItems, uint16_t nItems)
+{
+  uint8_t const *items = (uint8_t const*)pToItems;
+  uint16_t nFreeItems = fifo->queueSizeInItems - fifo->itemsCnt;
+  uint16_t nWrittenItems = nItems;
+  uint16_t index = GetIndexAfter(fifo, fifo->tail, fifo->itemsCnt);
+
+  if (0 == nItems)
+  {
+    return 0;
+  }
+
+  if (false == fifo->overwriteLastItems)
+  {
+    if (nWrittenItems > nFreeItems)
+    {
+      nWrittenItems = nFreeItems;
+      nItems = nFreeItems;
+    }
+
+    if (0 == nWrittenItems)
+    {
+      return 0;
+    }
+  }
+  else if (nWrittenItems > fifo->queueSizeInItems)
+  {
+    /* Overwritten items are skipped, but they move the place of the next ones as if they were pushed */
+    uint16_t nSkippedItems = nItems - fifo->queueSizeInItems;
+
+    items += (size_t)nSkippedItems * fifo->itemSize;
+    index = GetIndexAfter(fifo, index, nSkippedItems);
+    nWrittenItems = fifo->queueSizeInItems;
+  }
+
+  CopyToBuffer(fifo, index, items, nWrittenItems);
+
+  fifo->head = GetIndexAfter(fifo, index, nWrittenItems - 1U);
+
+  if ((uint32_t)fifo->itemsCnt + nItems > fifo->queueSizeInItems)
+  {
+    fifo->itemsCnt = fifo->queueSizeInItems;
+    fifo->tail = GetIndexAfter(fifo, fifo->head, 1);
+  }
+  else
+  {
+    fifo->itemsCnt += nItems;
+  }
+
+  fifo->isEmpty = false;
+
+  return nItems;
+}
+
+uint16_t SFIFO_PopItems(SFIFO_T * const fifo, void * const pToItems, uint16_t nItems)
+{
+  if (nItems > fifo->itemsCnt)
+  {
+    nItems = fifo->itemsCnt;
+  }
+
+  if (0 == nItems)
+  {
+    return 0;
+  }
+
+  CopyFromBuffer(fifo, fifo->tail, (uint8_t*)pToItems, nItems);
+  (void)SFIFO_Consume(fifo, nItems);
+
+  return nItems;
+}
+
+uint16_t SFIFO_ReserveWrite(SFIFO_T * const fifo, SFIFO_Span_T spans[2])
+{
+  uint16_t nFreeItems = fifo->queueSizeInItems - fifo->itemsCnt;
+  uint16_t index = GetIndexAfter(fifo, fifo->tail, fifo->itemsCnt);
+  uint16_t nFirstItems = fifo->queueSizeInItems - index;
+
+  if (nFirstItems > nFreeItems)
+  {
+    nFirstItems = nFreeItems;
+  }
+
+  spans[0].pData = &fifo->buffer[(size_t)index * fifo->itemSize];
+  spans[0].nItems = nFirstItems;
+  spans[1].pData = fifo->buffer;
+  spans[1].nItems = nFreeItems - nFirstItems;
+
+  return nFreeItems;
+}
+
+bool SFIFO_CommitWrite(SFIFO_T * const fifo, uint16_t nItems)
+{
+  if (nItems > fifo->queueSizeInItems - fifo->itemsCnt)
+  {
+    return false;
+  }
+
+  if (0 != nItems)
+  {
+    fifo->itemsCnt += nItems;
+    fifo->head = GetIndexAfter(fifo, fifo->tail, fifo->itemsCnt - 1U);
+    fifo->isEmpty = false;
+  }
+
+  return true;
+}
+
+uint16_t SFIFO_PeekRead(SFIFO_T * const fifo, SFIFO_Span_T spans[2])
+{
+  uint16_t nFirstItems = fifo->queueSizeInItems - fifo->tail;
+
+  if (nFirstItems > fifo->itemsCnt)
+  {
+    nFirstItems = fifo->itemsCnt;
+  }
+
+  spans[0].pData = &fifo->buffer[(size_t)fifo->tail * fifo->itemSize];
+  spans[0].nItems = nFirstItems;
+  spans[1].pData = fifo->buffer;
+  spans[1].nItems = fifo->itemsCnt - nFirstItems;
+
+  return fifo->itemsCnt;
+}
+
+bool SFIFO_Consume(SFIFO_T * const fifo, uint16_t nItems)
+{
+  if (nItems > fifo->itemsCnt)
+  {
+    return false;
+  }
+
+  if (0 != nItems)
+  {
+    fifo->tail = GetIndexAfter(fifo, fifo->tail, nItems);
+    fifo->itemsCnt -= nItems;
+    fifo->isFull = false;
+
+    if (true == SFIFO_IsEmpty(fifo))
+    {
+      SFIFO_Clear(fifo);
+    }
+  }
+
+  return true;
+}
+
 bool SFIFO_GetItem(SFIFO_T * const fifo, uint16_t itemIndex, void * const pToItem)
 {
   bool ret;
@@ -186,10 +369,7 @@ bool SFIFO_GetItem(SFIFO_T * const fifo, uint16_t itemIndex, void * const pToIte
       offset = fifo->itemSize * (fifo->tail + itemIndex);
     }
 
-    for (uint16_t byteCnt = 0; byteCnt < fifo->itemSize; byteCnt++)
-    {
-      ((uint8_t*)pToItem)[byteCnt] = fifo->buffer[offset + byteCnt];
-    }
+    memcpy(pToItem, &fifo->buffer[offset], fifo->itemSize);
 
     ret = true;
   }
@@ -209,10 +389,7 @@ bool SFIFO_GetLastPushedItem(SFIFO_T * const fifo, void * const pToItem)
   {
     offset = fifo->head * fifo->itemSize;
 
-    for (uint16_t byteCnt = 0; byteCnt < fifo->itemSize; byteCnt++)
-    {
-      ((uint8_t*)pToItem)[byteCnt] = fifo->buffer[offset + byteCnt];
-    }
+    memcpy(pToItem, &fifo->buffer[offset], fifo->itemSize);
 
     return true;
   }
@@ -273,10 +450,7 @@ bool SFIFO_UpdateLastPushedItem(SFIFO_T * const fifo, void const * const pToItem
   {
     offset = fifo->head * fifo->itemSize;
 
-    for (uint16_t byteCnt = 0; byteCnt < fifo->itemSize; byteCnt++)
-    {
-      fifo->buffer[offset + byteCnt] = ((uint8_t*)pToItem)[byteCnt];
-    }
+    memcpy(&fifo->buffer[offset], pToItem, fifo->itemSize);
 
     return true;
   }
@@ -103,6 +103,13 @@ typedef struct SFIFO_Tag
   bool overwriteLastItems;      ///< Select overwrite mode flag
 } SFIFO_T;
 
+/** Contiguous part of queue buffer */
+typedef struct SFIFO_Span_Tag
+{
+  uint8_t *pData;               ///< Pointer to the first item of span
+  uint16_t nItems;              ///< Number of items in span, may be 0
+} SFIFO_Span_T;
+
 /*======================================================================================*/
 /*                    ####### EXPORTED OBJECT DECLARATIONS #######                      */
 /*======================================================================================*/
@@ -132,6 +139,77 @@ bool SFIFO_PushItem(SFIFO_T * const fifo, void const * const pToItem);
 bool SFIFO_PopItem(SFIFO_T * const fifo, void * const pToItem);
 
 
+/**
+ * @brief   This function pushes many items into queue, they are copied by at most two memcpy calls.
+ *
+ *          In overwrite mode all items are pushed and only the last ones, which fit in queue, are kept,
+ *          as if they were pushed one by one by #SFIFO_PushItem.
+ * @param   [in] fifo       is queue handle equals name of created FIFO queue
+ * @param   [in] pToItems   is pointer to array of pushed items
+ * @param   [in] nItems     is number of items in array
+ * @return  Number of pushed items, less than nItems if queue has got full.
+ */
+uint16_t SFIFO_PushItems(SFIFO_T * const fifo, void const * const pToItems, uint16_t nItems);
+
+
+/**
+ * @brief   This function pops many items from queue, they are copied by at most two memcpy calls.
+ * @param   [in] fifo       is queue handle equals name of created FIFO queue
+ * @param   [out] pToItems  is pointer to array where popped items should be written
+ * @param   [in] nItems     is maximal number of popped items
+ * @return  Number of popped items, less than nItems if queue has got empty.
+ */
+uint16_t SFIFO_PopItems(SFIFO_T * const fifo, void * const pToItems, uint16_t nItems);
+
+
+/**
+ * @brief   This function returns free places of queue, so that producer can write items directly into them.
+ *
+ *          Free places are in two spans when they wrap around the end of buffer. Items written into spans
+ *          are pushed by #SFIFO_CommitWrite, in order of spans. Only free places are returned also in overwrite
+ *          mode. Queue must not be pushed or popped between reservation and commit.
+ * @param   [in] fifo       is queue handle equals name of created FIFO queue
+ * @param   [out] spans     is array of two spans, the second one is empty if free places do not wrap around
+ * @return  Number of free places in both spans.
+ */
+uint16_t SFIFO_ReserveWrite(SFIFO_T * const fifo, SFIFO_Span_T spans[2]);
+
+
+/**
+ * @brief   This function pushes items written into spans returned by #SFIFO_ReserveWrite.
+ * @param   [in] fifo       is queue handle equals name of created FIFO queue
+ * @param   [in] nItems     is number of written items
+ * @return  Result of the commit.
+ * @retval  true if items pushed properly
+ * @retval  false if there is less free places than nItems, nothing is pushed then
+ */
+bool SFIFO_CommitWrite(SFIFO_T * const fifo, uint16_t nItems);
+
+
+/**
+ * @brief   This function returns items of queue in place, so that consumer can process them without copying.
+ *
+ *          Items are in two spans when they wrap around the end of buffer, the oldest item is the first one
+ *          of the first span. Items stay in queue until they are released by #SFIFO_Consume. Queue must not
+ *          be pushed or popped in between.
+ * @param   [in] fifo       is queue handle equals name of created FIFO queue
+ * @param   [out] spans     is array of two spans, the second one is empty if items do not wrap around
+ * @return  Number of items in both spans.
+ */
+uint16_t SFIFO_PeekRead(SFIFO_T * const fifo, SFIFO_Span_T spans[2]);
+
+
+/**
+ * @brief   This function removes the oldest items from queue, usually after they are read by #SFIFO_PeekRead.
+ * @param   [in] fifo       is queue handle equals name of created FIFO queue
+ * @param   [in] nItems     is number of removed items
+ * @return  Result of the removal.
+ * @retval  true if items removed properly
+ * @retval  false if there is less items in queue than nItems, nothing is removed then
+ */
+bool SFIFO_Consume(SFIFO_T * const fifo, uint16_t nItems);
+
+
 /**
  * @brief   This function gets item from queue on given index.
  * @param   [in] fifo       is queue handle equals name of created FIFO queue
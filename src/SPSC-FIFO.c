@@ -0,0 +1,139 @@
+/*=======================================================================================*
+ * @file    SPSC-FIFO.c
+ * @author  Damian Pala
+ * @date    18-10-2026
+ * @brief   This file contains all implementations for SPSC-FIFO module.
+ *======================================================================================*/
+
+/**
+ * @addtogroup SPSC-FIFO Lock-free Single Producer Single Consumer FIFO Queue
+ * @{
+ * @brief This module contains implementation of lock-free SPSC FIFO.
+ */
+
+/*======================================================================================*/
+/*                       ####### PREPROCESSOR DIRECTIVES #######                        */
+/*======================================================================================*/
+/*-------------------------------- INCLUDE DIRECTIVES ----------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <stdatomic.h>
+
+#include "SPSC-FIFO.h"
+
+/*----------------------------- LOCAL OBJECT-LIKE MACROS -------------------------------*/
+
+/*---------------------------- LOCAL FUNCTION-LIKE MACROS ------------------------------*/
+
+/*======================================================================================*/
+/*                      ####### LOCAL TYPE DECLARATIONS #######                         */
+/*======================================================================================*/
+/*-------------------------------- OTHER TYPEDEFS --------------------------------------*/
+
+/*------------------------------------- ENUMS ------------------------------------------*/
+
+/*------------------------------- STRUCT AND UNIONS ------------------------------------*/
+
+/*======================================================================================*/
+/*                         ####### OBJECT DEFINITIONS #######                           */
+/*======================================================================================*/
+/*--------------------------------- EXPORTED OBJECTS -----------------------------------*/
+
+/*---------------------------------- LOCAL OBJECTS -------------------------------------*/
+
+/*======================================================================================*/
+/*                    ####### LOCAL FUNCTIONS PROTOTYPES #######                        */
+/*======================================================================================*/
+static inline uint16_t GetDistance(SPSCFIFO_T const * const fifo, uint16_t head, uint16_t tail);
+static inline uint16_t GetNextIndex(SPSCFIFO_T const * const fifo, uint16_t index);
+static inline uint8_t* GetItemAddress(SPSCFIFO_T const * const fifo, uint16_t index);
+
+/*======================================================================================*/
+/*                   ####### LOCAL FUNCTIONS DEFINITIONS #######                        */
+/*======================================================================================*/
+/* Indices are in range 0 to 2 * size - 1, distance equal to size means full queue */
+static inline uint16_t GetDistance(SPSCFIFO_T const * const fifo, uint16_t head, uint16_t tail)
+{
+  return (head >= tail) ? (uint16_t)(head - tail) : (uint16_t)(head + 2 * fifo->queueSizeInItems - tail);
+}
+
+static inline uint16_t GetNextIndex(SPSCFIFO_T const * const fifo, uint16_t index)
+{
+  return (index == 2 * fifo->queueSizeInItems - 1) ? 0 : (uint16_t)(index + 1);
+}
+
+static inline uint8_t* GetItemAddress(SPSCFIFO_T const * const fifo, uint16_t index)
+{
+  if (index >= fifo->queueSizeInItems)
+  {
+    index -= fifo->queueSizeInItems;
+  }
+
+  return &fifo->buffer[(size_t)index * fifo->itemSize];
+}
+
+/*======================================================================================*/
+/*                  ####### EXPORTED FUNCTIONS DEFINITIONS #######                      */
+/*======================================================================================*/
+bool SPSCFIFO_PushItem(SPSCFIFO_T * const fifo, void const * const pToItem)
+{
+  uint16_t head = atomic_load_explicit(&fifo->head, memory_order_relaxed);
+
+  if (GetDistance(fifo, head, fifo->cachedTail) == fifo->queueSizeInItems)
+  {
+    fifo->cachedTail = atomic_load_explicit(&fifo->tail, memory_order_acquire);
+
+    if (GetDistance(fifo, head, fifo->cachedTail) == fifo->queueSizeInItems)
+    {
+      return false;
+    }
+  }
+
+  memcpy(GetItemAddress(fifo, head), pToItem, fifo->itemSize);
+  atomic_store_explicit(&fifo->head, GetNextIndex(fifo, head), memory_order_release);
+
+  return true;
+}
+
+bool SPSCFIFO_PopItem(SPSCFIFO_T * const fifo, void * const pToItem)
+{
+  uint16_t tail = atomic_load_explicit(&fifo->tail, memory_order_relaxed);
+
+  if (tail == fifo->cachedHead)
+  {
+    fifo->cachedHead = atomic_load_explicit(&fifo->head, memory_order_acquire);
+
+    if (tail == fifo->cachedHead)
+    {
+      return false;
+    }
+  }
+
+  memcpy(pToItem, GetItemAddress(fifo, tail), fifo->itemSize);
+  atomic_store_explicit(&fifo->tail, GetNextIndex(fifo, tail), memory_order_release);
+
+  return true;
+}
+
+bool SPSCFIFO_IsEmpty(SPSCFIFO_T * const fifo)
+{
+  return (0 == SPSCFIFO_GetItemsInFifo(fifo));
+}
+
+bool SPSCFIFO_IsFull(SPSCFIFO_T * const fifo)
+{
+  return (SPSCFIFO_GetItemsInFifo(fifo) == fifo->queueSizeInItems);
+}
+
+uint16_t SPSCFIFO_GetItemsInFifo(SPSCFIFO_T * const fifo)
+{
+  uint16_t tail = atomic_load_explicit(&fifo->tail, memory_order_acquire);
+  uint16_t head = atomic_load_explicit(&fifo->head, memory_order_acquire);
+
+  return GetDistance(fifo, head, tail);
+}
+
+/**
+ * @} end of group SPSC-FIFO Lock-free Single Producer Single Consumer FIFO Queue
+ */
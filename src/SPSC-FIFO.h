@@ -0,0 +1,148 @@
+/*=======================================================================================*
+ * @file    SPSC-FIFO.h
+ * @author  Damian Pala
+ * @date    18-10-2026
+ * @brief   Header file for SPSC-FIFO module
+ *
+ *          This file contains API of SPSC-FIFO module
+ *======================================================================================*/
+/*----------------------- DEFINE TO PREVENT RECURSIVE INCLUSION ------------------------*/
+#ifndef SPSC_FIFO_H_
+#define SPSC_FIFO_H_
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/**
+ * @addtogroup SPSC-FIFO Lock-free Single Producer Single Consumer FIFO Queue
+ * @{
+ * @brief SPSC-FIFO module contains lock-free static FIFO queue shared by one producer and one consumer.
+ *
+ *        Items have to be fixed size and size of queue has to be fixed, as in S-FIFO module. Producer
+ *        (thread or ISR) only pushes and consumer only pops, then no lock is needed. Each side writes only
+ *        its own index, other side reads it with acquire ordering, so item copied into buffer is visible
+ *        before index which publishes it. Indices run from 0 to 2 * size - 1, so full and empty queue are
+ *        distinguished without shared items counter, and queue size does not have to be power of two.
+ *        Module requires C11 atomics.
+ */
+
+/*======================================================================================*/
+/*                       ####### PREPROCESSOR DIRECTIVES #######                        */
+/*======================================================================================*/
+/*-------------------------------- INCLUDE DIRECTIVES ----------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+
+/*----------------------------- LOCAL OBJECT-LIKE MACROS -------------------------------*/
+#ifndef SPSCFIFO_CACHE_LINE_SIZE
+#define SPSCFIFO_CACHE_LINE_SIZE      64    ///< Producer and consumer indices are kept in separate cache lines
+#endif
+
+/*---------------------------- LOCAL FUNCTION-LIKE MACROS ------------------------------*/
+/**
+ * @brief Macro function responsible for memory allocation, queue object and handle creation.
+ * @param [in] name is the name of queue handle
+ * @param [in] item_size is the item size in bytes
+ * @param [in] queue_size_in_items is the size of queue counted in items, up to 32767
+ */
+#define SPSCFIFO_Create(name, item_size, queue_size_in_items) \
+  static uint8_t name ## _buffer[item_size * queue_size_in_items]; \
+  static SPSCFIFO_T name ## _data = \
+  { \
+    0, \
+    0, \
+    0, \
+    0, \
+    name ## _buffer, \
+    item_size, \
+    queue_size_in_items \
+  }; \
+  static SPSCFIFO_T * name = &name ## _data;
+
+/*======================================================================================*/
+/*                     ####### EXPORTED TYPE DECLARATIONS #######                       */
+/*======================================================================================*/
+/*-------------------------------- OTHER TYPEDEFS --------------------------------------*/
+
+/*------------------------------------- ENUMS ------------------------------------------*/
+
+/*------------------------------- STRUCT AND UNIONS ------------------------------------*/
+/** FIFO structure definition */
+typedef struct SPSCFIFO_Tag
+{
+  _Alignas(SPSCFIFO_CACHE_LINE_SIZE) _Atomic uint16_t head; ///< Index of next pushed item, written by producer
+  uint16_t cachedTail;          ///< Tail read by producer lately, it is reloaded only when queue looks full
+  _Alignas(SPSCFIFO_CACHE_LINE_SIZE) _Atomic uint16_t tail; ///< Index of next popped item, written by consumer
+  uint16_t cachedHead;          ///< Head read by consumer lately, it is reloaded only when queue looks empty
+  _Alignas(SPSCFIFO_CACHE_LINE_SIZE) uint8_t *buffer;       ///< Queue buffer
+  uint16_t itemSize;            ///< Item size in bytes
+  uint16_t queueSizeInItems;    ///< Queue size in items
+} SPSCFIFO_T;
+
+/*======================================================================================*/
+/*                    ####### EXPORTED OBJECT DECLARATIONS #######                      */
+/*======================================================================================*/
+
+/*======================================================================================*/
+/*                   ####### EXPORTED FUNCTIONS PROTOTYPES #######                      */
+/*======================================================================================*/
+/**
+ * @brief   This function pushes item into queue, it may be called only by producer.
+ * @param   [in] fifo       is queue handle equals name of created FIFO queue
+ * @param   [in] pToItem    is pointer to pushed item
+ * @return  Result of the pushing operation.
+ * @retval  true if item pushed properly
+ * @retval  false if queue is full
+ */
+bool SPSCFIFO_PushItem(SPSCFIFO_T * const fifo, void const * const pToItem);
+
+
+/**
+ * @brief   This function pops item from queue, it may be called only by consumer.
+ * @param   [in] fifo       is queue handle equals name of created FIFO queue
+ * @param   [out] pToItem   is pointer to place where popped item should be written
+ * @return  Result of the popping operation.
+ * @retval  true if item popped properly
+ * @retval  false if queue is empty
+ */
+bool SPSCFIFO_PopItem(SPSCFIFO_T * const fifo, void * const pToItem);
+
+
+/**
+ * @brief   This function checks if queue is empty. Result is exact only when called by consumer.
+ * @param   [in] fifo       is queue handle equals name of created FIFO queue
+ * @return  True or False
+ */
+bool SPSCFIFO_IsEmpty(SPSCFIFO_T * const fifo);
+
+
+/**
+ * @brief   This function checks if queue is full. Result is exact only when called by producer.
+ * @param   [in] fifo       is queue handle equals name of created FIFO queue
+ * @return  True or False
+ */
+bool SPSCFIFO_IsFull(SPSCFIFO_T * const fifo);
+
+
+/**
+ * @brief   This function returns number of items in queue, it may be outdated when other side works.
+ * @param   [in] fifo       is queue handle equals name of created FIFO queue
+ * @return  Number of items in queue.
+ */
+uint16_t SPSCFIFO_GetItemsInFifo(SPSCFIFO_T * const fifo);
+
+/*======================================================================================*/
+/*                          ####### INLINE FUNCTIONS #######                            */
+/*======================================================================================*/
+
+/**
+ * @} end of group SPSC-FIFO Lock-free Single Producer Single Consumer FIFO Queue
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SPSC_FIFO_H_ */
@@ -0,0 +1,118 @@
+/*=======================================================================================*
+ * @file    TC_CPUF.c
+ * @author  Damian Pala
+ * @date    18-10-2026
+ * @brief   This file contains unit tests for CPUF module.
+ *======================================================================================*/
+
+/**
+ * @addtogroup TC_CPUF CPU features detection tests
+ * @{
+ * @brief Unit tests implementation.
+ */
+
+/*======================================================================================*/
+/*                       ####### PREPROCESSOR DIRECTIVES #######                        */
+/*======================================================================================*/
+/*---------------------- INCLUDE DIRECTIVES FOR STANDARD HEADERS -----------------------*/
+
+/*----------------------- INCLUDE DIRECTIVES FOR OTHER HEADERS -------------------------*/
+#include "unity.h"
+#include "unity_fixture.h"
+
+#include "CPUF.c"
+
+/*----------------------------- LOCAL OBJECT-LIKE MACROS -------------------------------*/
+
+/*---------------------------- LOCAL FUNCTION-LIKE MACROS ------------------------------*/
+
+/*======================================================================================*/
+/*                      ####### LOCAL TYPE DECLARATIONS #######                         */
+/*======================================================================================*/
+/*-------------------------------- OTHER TYPEDEFS --------------------------------------*/
+
+/*------------------------------------- ENUMS ------------------------------------------*/
+
+/*------------------------------- STRUCT AND UNIONS ------------------------------------*/
+
+/*======================================================================================*/
+/*                         ####### OBJECT DEFINITIONS #######                           */
+/*======================================================================================*/
+/*--------------------------------- EXPORTED OBJECTS -----------------------------------*/
+
+/*---------------------------------- LOCAL OBJECTS -------------------------------------*/
+/**
+ * @brief   CPUF Test Group.
+ */
+TEST_GROUP(CPUF);
+
+/*======================================================================================*/
+/*                    ####### LOCAL FUNCTIONS PROTOTYPES #######                        */
+/*======================================================================================*/
+
+/*======================================================================================*/
+/*                   ####### LOCAL FUNCTIONS DEFINITIONS #######                        */
+/*======================================================================================*/
+
+/*======================================================================================*/
+/*                        ####### TESTS DEFINITIONS #######                             */
+/*======================================================================================*/
+/**
+ * @brief   Setup Test Environment.
+ */
+TEST_SETUP(CPUF)
+{
+
+}
+
+/**
+ * @brief   Tear Down Test Environment.
+ */
+TEST_TEAR_DOWN(CPUF)
+{
+
+}
+
+TEST(CPUF, CPUF_GetFeatures_should_ReportConsistentFeatures)
+{
+  uint32_t features = CPUF_GetFeatures();
+
+  TEST_ASSERT_EQUAL_HEX32(features, CPUF_GetFeatures());
+  TEST_ASSERT_EQUAL_HEX32(0, features & ~(uint32_t)CPUF_FEATURES_MASK);
+
+  if (0 != (features & CPUF_FEATURE_AVX2))
+  {
+    TEST_ASSERT_TRUE(CPUF_IsSupported(CPUF_FEATURE_AVX) || (0 == (CPUF_FEATURES_MASK & CPUF_FEATURE_AVX)));
+  }
+
+  if (0 != (features & (CPUF_FEATURE_AVX512F | CPUF_FEATURE_AVX512BW | CPUF_FEATURE_VPCLMULQDQ)))
+  {
+    TEST_ASSERT_TRUE(CPUF_IsSupported(CPUF_FEATURE_AVX) || (0 == (CPUF_FEATURES_MASK & CPUF_FEATURE_AVX)));
+  }
+
+#if defined(CPUF_DETECTION_ENABLED) && defined(__x86_64__)
+  /* SSE2 is part of x86-64 architecture */
+  TEST_ASSERT_EQUAL(0 != (CPUF_FEATURES_MASK & CPUF_FEATURE_SSE2), CPUF_IsSupported(CPUF_FEATURE_SSE2));
+#endif
+}
+
+TEST(CPUF, CPUF_IsSupported_should_RequireAllGivenFeatures)
+{
+  uint32_t features = CPUF_GetFeatures();
+  bool isSse2Supported = (0 != (features & CPUF_FEATURE_SSE2));
+
+  TEST_ASSERT_TRUE(CPUF_IsSupported(0));
+  TEST_ASSERT_TRUE(CPUF_IsSupported(features));
+
+  for (uint32_t feature = CPUF_FEATURE_SSE2; feature <= CPUF_FEATURE_VPCLMULQDQ; feature <<= 1)
+  {
+    bool isSupported = (0 != (features & feature));
+
+    TEST_ASSERT_EQUAL(isSupported, CPUF_IsSupported(feature));
+    TEST_ASSERT_EQUAL(isSupported && isSse2Supported, CPUF_IsSupported(feature | CPUF_FEATURE_SSE2));
+  }
+}
+
+/**
+ * @} end of group TC_CPUF
+ */
@@ -15,6 +15,7 @@
 /*                       ####### PREPROCESSOR DIRECTIVES #######                        */
 /*======================================================================================*/
 /*---------------------- INCLUDE DIRECTIVES FOR STANDARD HEADERS -----------------------*/
+#include <string.h>
 
 /*----------------------- INCLUDE DIRECTIVES FOR OTHER HEADERS -------------------------*/
 #include "unity.h"
@@ -50,6 +51,11 @@ TEST_GROUP(CRC);
 /*                    ####### LOCAL FUNCTIONS PROTOTYPES #######                        */
 /*======================================================================================*/
 static uint32_t CalcIterateCrc(uint8_t *data, size_t dataSize, CRC_CalcSize_T crcSize);
+static uint32_t CalcReferenceCrc(uint8_t const *data, size_t dataSize, uint8_t width, uint32_t polynom,
+                                 uint32_t initVal, uint32_t xorVal);
+static uint32_t CalcReferenceCrc32c(uint8_t const *data, size_t dataSize);
+static void FillTestBuffer(uint8_t *buffer, size_t bufferSize, uint32_t seed);
+static uint32_t CalcCtxCrc(void const *data, size_t dataSize, CRC_CalcSize_T crcSize);
 
 /*======================================================================================*/
 /*                   ####### LOCAL FUNCTIONS DEFINITIONS #######                        */
@@ -170,6 +176,69 @@ static uint32_t CalcIterateCrc(uint8_t *data, size_t dataSize, CRC_CalcSize_T cr
   return crc;
 }
 
+static uint32_t CalcReferenceCrc(uint8_t const *data, size_t dataSize, uint8_t width, uint32_t polynom,
+                                 uint32_t initVal, uint32_t xorVal)
+{
+  uint32_t msBit = (uint32_t)1 << (width - 1);
+  uint32_t mask = (msBit << 1) - 1;
+  uint32_t remainder = initVal;
+
+  for (size_t byteCnt = 0; byteCnt < dataSize; byteCnt++)
+  {
+    remainder ^= (uint32_t)data[byteCnt] << (width - 8);
+
+    for (uint8_t nBit = 0; nBit < 8; nBit++)
+    {
+      if (remainder & msBit)
+      {
+        remainder = (remainder << 1) ^ polynom;
+      }
+      else
+      {
+        remainder = (remainder << 1);
+      }
+    }
+  }
+
+  return ((remainder ^ xorVal) & mask);
+}
+
+static uint32_t CalcReferenceCrc32c(uint8_t const *data, size_t dataSize)
+{
+  uint32_t remainder = 0xFFFFFFFF;
+
+  for (size_t byteCnt = 0; byteCnt < dataSize; byteCnt++)
+  {
+    remainder ^= data[byteCnt];
+
+    for (uint8_t nBit = 0; nBit < 8; nBit++)
+    {
+      remainder = (remainder & 1) ? ((remainder >> 1) ^ 0x82F63B78) : (remainder >> 1);
+    }
+  }
+
+  return (remainder ^ 0xFFFFFFFF);
+}
+
+static void FillTestBuffer(uint8_t *buffer, size_t bufferSize, uint32_t seed)
+{
+  for (size_t byteCnt = 0; byteCnt < bufferSize; byteCnt++)
+  {
+    seed = seed * 1103515245 + 12345;
+    buffer[byteCnt] = (uint8_t)(seed >> 16);
+  }
+}
+
+static uint32_t CalcCtxCrc(void const *data, size_t dataSize, CRC_CalcSize_T crcSize)
+{
+  CRC_Ctx_T ctx;
+
+  CRC_CtxInit(&ctx, crcSize);
+  CRC_CtxUpdate(&ctx, data, dataSize);
+
+  return CRC_CtxFinal(&ctx);
+}
+
 TEST(CRC, CRC8_should_BeCalculatedProperly)
 {
   uint32_t crc;
@@ -264,6 +333,400 @@ TEST(CRC, CRC32_should_BeCalculatedProperly)
   TEST_ASSERT_EQUAL_HEX32(CRC_TestData[testIterator].crc32, crc);
 }
 
+TEST(CRC, CRC_Tables_should_MatchBitwiseAlgorithm)
+{
+#if CRC_CALC_METHOD == CRC_CALC_METHOD_TABLE
+  CRC_TestData_T *testData = &CRC_TestData[0];
+
+  for (uint16_t idx = 0; idx < 256; idx++)
+  {
+    uint8_t byte = (uint8_t)idx;
+
+    TEST_ASSERT_EQUAL_HEX8(CalcReferenceCrc(&byte, 1, 8, testData->crc8_polynom, 0, 0), Crc8Table[idx]);
+    TEST_ASSERT_EQUAL_HEX16(CalcReferenceCrc(&byte, 1, 16, testData->crc16_polynom, 0, 0), Crc16Table[idx]);
+    TEST_ASSERT_EQUAL_HEX32(CalcReferenceCrc(&byte, 1, 32, testData->crc32_polynom, 0, 0), Crc32Table[idx]);
+  }
+#ifdef CRC32_SLICING_ENABLED
+  for (uint8_t slice = 0; slice < CRC32_SLICING - 1; slice++)
+  {
+    uint8_t data[CRC32_SLICING] = {0};
+
+    for (uint16_t idx = 0; idx < 256; idx++)
+    {
+      data[0] = (uint8_t)idx;
+
+      TEST_ASSERT_EQUAL_HEX32(CalcReferenceCrc(data, slice + 2U, 32, testData->crc32_polynom, 0, 0),
+                              Crc32SliceTable[slice][idx]);
+    }
+  }
+#endif
+#elif CRC_CALC_METHOD == CRC_CALC_METHOD_NIBBLE
+  CRC_TestData_T *testData = &CRC_TestData[0];
+
+  for (uint8_t idx = 0; idx < 16; idx++)
+  {
+    /* Nibble in low bits of a byte is processed by the bitwise algorithm as nibble at MSB followed by 4 zero bits */
+    uint8_t byte = idx;
+
+    TEST_ASSERT_EQUAL_HEX8(CalcReferenceCrc(&byte, 1, 8, testData->crc8_polynom, 0, 0), Crc8NibbleTable[idx]);
+    TEST_ASSERT_EQUAL_HEX16(CalcReferenceCrc(&byte, 1, 16, testData->crc16_polynom, 0, 0), Crc16NibbleTable[idx]);
+    TEST_ASSERT_EQUAL_HEX32(CalcReferenceCrc(&byte, 1, 32, testData->crc32_polynom, 0, 0), Crc32NibbleTable[idx]);
+  }
+#else
+  TEST_IGNORE_MESSAGE("Lookup tables are not used by selected CRC_CALC_METHOD");
+#endif
+}
+
+TEST(CRC, CRC_should_MatchBitwiseAlgorithmOnLongBuffers)
+{
+  static uint8_t buffer[4099];
+  CRC_TestData_T *testData = &CRC_TestData[0];
+
+  FillTestBuffer(buffer, sizeof(buffer), 0xC0FFEE);
+
+  for (size_t size = 0; size <= sizeof(buffer); size += (size < 64) ? 1 : 509)
+  {
+    TEST_ASSERT_EQUAL_HEX8(CalcReferenceCrc(buffer, size, 8, testData->crc8_polynom, testData->crc8_initVal,
+                                            testData->crc8_xorVal), CRC_CalcCRC8(buffer, size));
+    TEST_ASSERT_EQUAL_HEX16(CalcReferenceCrc(buffer, size, 16, testData->crc16_polynom, testData->crc16_initVal,
+                                             testData->crc16_xorVal), CRC_CalcCRC16(buffer, size));
+    TEST_ASSERT_EQUAL_HEX32(CalcReferenceCrc(buffer, size, 32, testData->crc32_polynom, testData->crc32_initVal,
+                                             testData->crc32_xorVal), CRC_CalcCRC32(buffer, size));
+  }
+}
+
+TEST(CRC, CRC32_should_BeCalculatedProperlyForEveryLengthAndAlignment)
+{
+  static uint8_t buffer[600];
+  CRC_TestData_T *testData = &CRC_TestData[1];
+
+  FillTestBuffer(buffer, sizeof(buffer), 0xBADC0DE);
+
+  for (size_t offset = 0; offset < 4; offset++)
+  {
+    for (size_t size = 0; size <= sizeof(buffer) - offset; size++)
+    {
+      TEST_ASSERT_EQUAL_HEX32(CalcReferenceCrc(&buffer[offset], size, 32, testData->crc32_polynom,
+                                               testData->crc32_initVal, testData->crc32_xorVal),
+                              CRC_CalcCRC32(&buffer[offset], size));
+    }
+  }
+}
+
+TEST(CRC, CRC16_should_BeCalculatedProperlyForEveryLengthAndAlignment)
+{
+  static uint8_t buffer[600];
+  CRC_TestData_T *testData = &CRC_TestData[1];
+
+  FillTestBuffer(buffer, sizeof(buffer), 0xFACADE);
+
+  for (size_t offset = 0; offset < 4; offset++)
+  {
+    for (size_t size = 0; size <= sizeof(buffer) - offset; size++)
+    {
+      TEST_ASSERT_EQUAL_HEX16(CalcReferenceCrc(&buffer[offset], size, 16, testData->crc16_polynom,
+                                               testData->crc16_initVal, testData->crc16_xorVal),
+                              CRC_CalcCRC16(&buffer[offset], size));
+    }
+  }
+}
+
+TEST(CRC, CRC32C_should_MatchStandardCheckValues)
+{
+  uint8_t check[] = "123456789";
+  uint8_t data[32];
+
+  TEST_ASSERT_EQUAL_HEX32(0xE3069283, CRC_CalcCRC32C(check, sizeof(check) - 1));
+  TEST_ASSERT_EQUAL_HEX32(0xE3069283, CalcIterateCrc(check, sizeof(check) - 1, CRC_CALC_SIZE_32C));
+
+  memset(data, 0x00, sizeof(data));
+  TEST_ASSERT_EQUAL_HEX32(0x8A9136AA, CRC_CalcCRC32C(data, sizeof(data)));
+  memset(data, 0xFF, sizeof(data));
+  TEST_ASSERT_EQUAL_HEX32(0x62A8AB43, CRC_CalcCRC32C(data, sizeof(data)));
+  for (uint8_t idx = 0; idx < sizeof(data); idx++)
+  {
+    data[idx] = idx;
+  }
+  TEST_ASSERT_EQUAL_HEX32(0x46DD794E, CRC_CalcCRC32C(data, sizeof(data)));
+  for (uint8_t idx = 0; idx < sizeof(data); idx++)
+  {
+    data[idx] = sizeof(data) - 1 - idx;
+  }
+  TEST_ASSERT_EQUAL_HEX32(0x113FDB5C, CRC_CalcCRC32C(data, sizeof(data)));
+}
+
+TEST(CRC, CRC32C_should_BeCalculatedProperlyOnLongBuffers)
+{
+  static uint8_t buffer[3 * 2048 * 2 + 3 * 256 * 2 + 64];
+
+  FillTestBuffer(buffer, sizeof(buffer), 0x5EED);
+
+  for (size_t offset = 0; offset < 8; offset += 3)
+  {
+    for (size_t size = 0; size <= sizeof(buffer) - offset; size += (size < 1024) ? 1 : 97)
+    {
+      TEST_ASSERT_EQUAL_HEX32(CalcReferenceCrc32c(&buffer[offset], size), CRC_CalcCRC32C(&buffer[offset], size));
+    }
+  }
+}
+
+TEST(CRC, CRC_Ctx_should_CalculateInterleavedStreamsProperly)
+{
+  static uint8_t buffer[4 * 1500];
+  const CRC_CalcSize_T crcSizes[4] = {CRC_CALC_SIZE_8, CRC_CALC_SIZE_16, CRC_CALC_SIZE_32, CRC_CALC_SIZE_32C};
+  const size_t streamSize = sizeof(buffer) / 4;
+  CRC_Ctx_T ctx[4];
+  size_t offset = 0;
+  uint32_t seed = 1;
+
+  FillTestBuffer(buffer, sizeof(buffer), 0xC7C);
+
+  for (uint8_t stream = 0; stream < 4; stream++)
+  {
+    CRC_CtxInit(&ctx[stream], crcSizes[stream]);
+  }
+
+  while (offset < streamSize)
+  {
+    size_t chunkSize;
+
+    seed = seed * 1103515245 + 12345;
+    chunkSize = (seed >> 16) % 300;
+    if (chunkSize > streamSize - offset)
+    {
+      chunkSize = streamSize - offset;
+    }
+
+    for (uint8_t stream = 0; stream < 4; stream++)
+    {
+      CRC_CtxUpdate(&ctx[stream], &buffer[stream * streamSize + offset], chunkSize);
+    }
+
+    offset += chunkSize;
+  }
+
+  TEST_ASSERT_EQUAL_HEX8(CRC_CalcCRC8(&buffer[0], streamSize), CRC_CtxFinal(&ctx[0]));
+  TEST_ASSERT_EQUAL_HEX16(CRC_CalcCRC16(&buffer[streamSize], streamSize), CRC_CtxFinal(&ctx[1]));
+  TEST_ASSERT_EQUAL_HEX32(CRC_CalcCRC32(&buffer[2 * streamSize], streamSize), CRC_CtxFinal(&ctx[2]));
+  TEST_ASSERT_EQUAL_HEX32(CRC_CalcCRC32C(&buffer[3 * streamSize], streamSize), CRC_CtxFinal(&ctx[3]));
+}
+
+TEST(CRC, CRC_Combine_should_GiveCrcOfConcatenatedData)
+{
+  static uint8_t buffer[3000];
+  const CRC_CalcSize_T crcSizes[4] = {CRC_CALC_SIZE_8, CRC_CALC_SIZE_16, CRC_CALC_SIZE_32, CRC_CALC_SIZE_32C};
+  const size_t splits[] = {0, 1, 7, 64, 255, 1024, 2999, 3000};
+
+  FillTestBuffer(buffer, sizeof(buffer), 0xC0B1);
+
+  for (uint8_t sizeIdx = 0; sizeIdx < 4; sizeIdx++)
+  {
+    uint32_t crc = CalcCtxCrc(buffer, sizeof(buffer), crcSizes[sizeIdx]);
+
+    for (uint8_t splitIdx = 0; splitIdx < sizeof(splits) / sizeof(splits[0]); splitIdx++)
+    {
+      size_t split = splits[splitIdx];
+      uint32_t crcA = CalcCtxCrc(buffer, split, crcSizes[sizeIdx]);
+      uint32_t crcB = CalcCtxCrc(&buffer[split], sizeof(buffer) - split, crcSizes[sizeIdx]);
+
+      TEST_ASSERT_EQUAL_HEX32(crc, CRC_Combine(crcSizes[sizeIdx], crcA, crcB, sizeof(buffer) - split));
+    }
+  }
+
+  TEST_ASSERT_EQUAL_HEX8(CRC_CalcCRC8(buffer, 100),
+                         CRC_CombineCRC8(CRC_CalcCRC8(buffer, 40), CRC_CalcCRC8(&buffer[40], 60), 60));
+  TEST_ASSERT_EQUAL_HEX16(CRC_CalcCRC16(buffer, 100),
+                          CRC_CombineCRC16(CRC_CalcCRC16(buffer, 40), CRC_CalcCRC16(&buffer[40], 60), 60));
+  TEST_ASSERT_EQUAL_HEX32(CRC_CalcCRC32(buffer, 100),
+                          CRC_CombineCRC32(CRC_CalcCRC32(buffer, 40), CRC_CalcCRC32(&buffer[40], 60), 60));
+  TEST_ASSERT_EQUAL_HEX32(CRC_CalcCRC32C(buffer, 100),
+                          CRC_CombineCRC32C(CRC_CalcCRC32C(buffer, 40), CRC_CalcCRC32C(&buffer[40], 60), 60));
+}
+
+TEST(CRC, CRC_should_BeCalculatedProperlyForBuffersLongerThan64KiB)
+{
+  static uint8_t buffer[0x10000 + 4099];
+  CRC_TestData_T *testData = &CRC_TestData[2];
+
+  FillTestBuffer(buffer, sizeof(buffer), 0x64);
+
+  TEST_ASSERT_EQUAL_HEX8(CalcReferenceCrc(buffer, sizeof(buffer), 8, testData->crc8_polynom, testData->crc8_initVal,
+                                          testData->crc8_xorVal), CRC_CalcCRC8(buffer, sizeof(buffer)));
+  TEST_ASSERT_EQUAL_HEX16(CalcReferenceCrc(buffer, sizeof(buffer), 16, testData->crc16_polynom,
+                                           testData->crc16_initVal, testData->crc16_xorVal),
+                          CRC_CalcCRC16(buffer, sizeof(buffer)));
+  TEST_ASSERT_EQUAL_HEX32(CalcReferenceCrc(buffer, sizeof(buffer), 32, testData->crc32_polynom,
+                                           testData->crc32_initVal, testData->crc32_xorVal),
+                          CRC_CalcCRC32(buffer, sizeof(buffer)));
+  TEST_ASSERT_EQUAL_HEX32(CalcReferenceCrc32c(buffer, sizeof(buffer)), CRC_CalcCRC32C(buffer, sizeof(buffer)));
+}
+
+TEST(CRC, CRC_CalcBatch_should_GiveTheSameCrcsAsSingleBufferCalculation)
+{
+  static uint8_t buffer[8192];
+  const CRC_CalcSize_T crcSizes[4] = {CRC_CALC_SIZE_8, CRC_CALC_SIZE_16, CRC_CALC_SIZE_32, CRC_CALC_SIZE_32C};
+  uint8_t const *data[21];
+  size_t nBytes[21];
+  uint32_t crc[21];
+  uint32_t seed = 0xBA7C;
+
+  FillTestBuffer(buffer, sizeof(buffer), 0xBA7C);
+
+  for (uint8_t round = 0; round < 20; round++)
+  {
+    for (uint8_t buffIdx = 0; buffIdx < 21; buffIdx++)
+    {
+      seed = seed * 1103515245 + 12345;
+      nBytes[buffIdx] = (round < 10) ? (16 + (seed >> 8) % 113) : ((seed >> 8) % 300);
+
+      if (19 == round)
+      {
+        nBytes[buffIdx] = 200 + buffIdx;
+      }
+      data[buffIdx] = &buffer[(seed >> 16) % (sizeof(buffer) - 300)];
+    }
+
+    for (uint8_t sizeIdx = 0; sizeIdx < 4; sizeIdx++)
+    {
+      for (uint8_t nBuffers = 0; nBuffers <= 21; nBuffers += 7)
+      {
+        memset(crc, 0, sizeof(crc));
+        CRC_CalcBatch(crcSizes[sizeIdx], data, nBytes, crc, nBuffers);
+
+        for (uint8_t buffIdx = 0; buffIdx < nBuffers; buffIdx++)
+        {
+          TEST_ASSERT_EQUAL_HEX32(CalcCtxCrc(data[buffIdx], nBytes[buffIdx], crcSizes[sizeIdx]), crc[buffIdx]);
+        }
+      }
+    }
+  }
+}
+
+TEST(CRC, CRC_CopyAndCalc_should_CopyDataAndGiveTheSameCrc)
+{
+  static uint8_t src[2 * 1024 * 1024 + 64];
+  static uint8_t dst[2 * 1024 * 1024 + 64];
+  const size_t sizes[] = {1, 100, 4095, 4097, 3 * 4096 + 5, 2 * 1024 * 1024 + 3};
+
+  FillTestBuffer(src, sizeof(src), 0xC097);
+
+  TEST_ASSERT_EQUAL_HEX32(CRC_CalcCRC32(src, 0), CRC_CopyAndCalcCRC32(dst, src, 0));
+
+  for (uint8_t sizeIdx = 0; sizeIdx < sizeof(sizes) / sizeof(sizes[0]); sizeIdx++)
+  {
+    size_t size = sizes[sizeIdx];
+    uint8_t const *source = &src[sizeIdx];
+    uint8_t *destination = &dst[7 * sizeIdx % 16];
+
+    memset(dst, 0, sizeof(dst));
+    TEST_ASSERT_EQUAL_HEX8(CRC_CalcCRC8(source, size), CRC_CopyAndCalcCRC8(destination, source, size));
+    TEST_ASSERT_EQUAL_MEMORY(source, destination, size);
+
+    memset(dst, 0, sizeof(dst));
+    TEST_ASSERT_EQUAL_HEX16(CRC_CalcCRC16(source, size), CRC_CopyAndCalcCRC16(destination, source, size));
+    TEST_ASSERT_EQUAL_MEMORY(source, destination, size);
+
+    memset(dst, 0, sizeof(dst));
+    TEST_ASSERT_EQUAL_HEX32(CRC_CalcCRC32(source, size), CRC_CopyAndCalcCRC32(destination, source, size));
+    TEST_ASSERT_EQUAL_MEMORY(source, destination, size);
+
+    memset(dst, 0, sizeof(dst));
+    TEST_ASSERT_EQUAL_HEX32(CRC_CalcCRC32C(source, size), CRC_CopyAndCalcCRC32C(destination, source, size));
+    TEST_ASSERT_EQUAL_MEMORY(source, destination, size);
+    TEST_ASSERT_EQUAL_HEX8(0, destination[size]);
+  }
+}
+
+TEST(CRC, CRC_CalcSegments_should_GiveCrcOfConcatenatedSegments)
+{
+  static uint8_t buffer[1500];
+  CRC_Segment_T segments[12];
+  uint32_t seed = 0x5E6;
+  size_t offset = 0;
+  uint8_t nSegments;
+
+  FillTestBuffer(buffer, sizeof(buffer), 0x5E6);
+
+  for (nSegments = 0; (offset < sizeof(buffer)) && (nSegments < 11); nSegments++)
+  {
+    seed = seed * 1103515245 + 12345;
+    segments[nSegments].pData = &buffer[offset];
+    segments[nSegments].nBytes = (1 == nSegments % 3) ? 0 : (seed >> 16) % 300;
+    if (segments[nSegments].nBytes > sizeof(buffer) - offset)
+    {
+      segments[nSegments].nBytes = sizeof(buffer) - offset;
+    }
+    offset += segments[nSegments].nBytes;
+  }
+  segments[nSegments].pData = &buffer[offset];
+  segments[nSegments].nBytes = sizeof(buffer) - offset;
+  nSegments++;
+
+  TEST_ASSERT_EQUAL_HEX8(CRC_CalcCRC8(buffer, sizeof(buffer)), CRC_CalcSegmentsCRC8(segments, nSegments));
+  TEST_ASSERT_EQUAL_HEX16(CRC_CalcCRC16(buffer, sizeof(buffer)), CRC_CalcSegmentsCRC16(segments, nSegments));
+  TEST_ASSERT_EQUAL_HEX32(CRC_CalcCRC32(buffer, sizeof(buffer)), CRC_CalcSegmentsCRC32(segments, nSegments));
+  TEST_ASSERT_EQUAL_HEX32(CRC_CalcCRC32C(buffer, sizeof(buffer)), CRC_CalcSegmentsCRC32C(segments, nSegments));
+  TEST_ASSERT_EQUAL_HEX16(CRC_CalcCRC16(buffer, 0), CRC_CalcSegmentsCRC16(segments, 0));
+}
+
+TEST(CRC, CRC_Patch_should_GiveCrcOfModifiedData)
+{
+  static uint8_t buffer[5000];
+  static uint8_t oldBytes[300];
+  const CRC_CalcSize_T crcSizes[4] = {CRC_CALC_SIZE_8, CRC_CALC_SIZE_16, CRC_CALC_SIZE_32, CRC_CALC_SIZE_32C};
+  const size_t offsets[] = {0, 1, 100, 4700, 4999};
+  const size_t lengths[] = {1, 4, 65, 300, 1};
+
+  FillTestBuffer(buffer, sizeof(buffer), 0x9A7C);
+
+  for (uint8_t sizeIdx = 0; sizeIdx < 4; sizeIdx++)
+  {
+    for (uint8_t idx = 0; idx < sizeof(offsets) / sizeof(offsets[0]); idx++)
+    {
+      uint32_t crc = CalcCtxCrc(buffer, sizeof(buffer), crcSizes[sizeIdx]);
+
+      memcpy(oldBytes, &buffer[offsets[idx]], lengths[idx]);
+      FillTestBuffer(&buffer[offsets[idx]], lengths[idx], idx + 17 * sizeIdx);
+
+      TEST_ASSERT_EQUAL_HEX32(CalcCtxCrc(buffer, sizeof(buffer), crcSizes[sizeIdx]),
+                              CRC_Patch(crcSizes[sizeIdx], crc, sizeof(buffer), offsets[idx], oldBytes,
+                                        &buffer[offsets[idx]], lengths[idx]));
+    }
+  }
+
+  {
+    uint8_t newBytes[2] = {0x12, 0x34};
+    uint32_t crc32 = CRC_CalcCRC32(buffer, sizeof(buffer));
+    uint16_t crc16 = CRC_CalcCRC16(buffer, sizeof(buffer));
+
+    memcpy(oldBytes, &buffer[10], sizeof(newBytes));
+    memcpy(&buffer[10], newBytes, sizeof(newBytes));
+
+    TEST_ASSERT_EQUAL_HEX32(CRC_CalcCRC32(buffer, sizeof(buffer)),
+                            CRC_PatchCRC32(crc32, sizeof(buffer), 10, oldBytes, newBytes, sizeof(newBytes)));
+    TEST_ASSERT_EQUAL_HEX16(CRC_CalcCRC16(buffer, sizeof(buffer)),
+                            CRC_PatchCRC16(crc16, sizeof(buffer), 10, oldBytes, newBytes, sizeof(newBytes)));
+  }
+}
+
+TEST(CRC, CRC_Patch_should_ReturnUnchangedCrcWhenChangedBytesExceedData)
+{
+  uint8_t oldBytes[16] = {0};
+  uint8_t newBytes[16];
+  const size_t dataSize = 100;
+  const uint32_t crc = 0x89ABCDEF;
+
+  memset(newBytes, 0xA5, sizeof(newBytes));
+
+  TEST_ASSERT_EQUAL_HEX32(crc, CRC_Patch(CRC_CALC_SIZE_32, crc, dataSize, dataSize - 15, oldBytes, newBytes, 16));
+  TEST_ASSERT_EQUAL_HEX32(crc, CRC_Patch(CRC_CALC_SIZE_32C, crc, dataSize, dataSize + 1, oldBytes, newBytes, 0));
+  TEST_ASSERT_EQUAL_HEX32(crc, CRC_Patch(CRC_CALC_SIZE_32, crc, dataSize, 10, oldBytes, newBytes, SIZE_MAX - 5));
+  TEST_ASSERT_EQUAL_HEX16(0xCDEF, CRC_PatchCRC16(0xCDEF, 0, 0, oldBytes, newBytes, 1));
+
+  /* Changed bytes ending exactly at the data end are still patched */
+  TEST_ASSERT_NOT_EQUAL(crc, CRC_Patch(CRC_CALC_SIZE_32, crc, dataSize, dataSize - 16, oldBytes, newBytes, 16));
+}
+
 /**
  * @} end of group TC_S-FIFO Static FIFO Queue unit tests
  */
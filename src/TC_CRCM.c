@@ -0,0 +1,129 @@
+/*=======================================================================================*
+ * @file    TC_CRCM.c
+ * @author  Damian Pala
+ * @date    18-10-2026
+ * @brief   This file contains unit tests for CRCM module.
+ *======================================================================================*/
+
+/**
+ * @addtogroup TC_CRCM Rocksoft model CRC calculations tests
+ * @{
+ * @brief Unit tests implementation.
+ */
+
+/*======================================================================================*/
+/*                       ####### PREPROCESSOR DIRECTIVES #######                        */
+/*======================================================================================*/
+/*---------------------- INCLUDE DIRECTIVES FOR STANDARD HEADERS -----------------------*/
+
+/*----------------------- INCLUDE DIRECTIVES FOR OTHER HEADERS -------------------------*/
+#include "unity.h"
+#include "unity_fixture.h"
+
+#include "CRCM.c"
+
+/*----------------------------- LOCAL OBJECT-LIKE MACROS -------------------------------*/
+#define CHECK_STRING                  "123456789"
+#define CHECK_STRING_LENGTH           (sizeof(CHECK_STRING) - 1)
+
+/*---------------------------- LOCAL FUNCTION-LIKE MACROS ------------------------------*/
+
+/*======================================================================================*/
+/*                      ####### LOCAL TYPE DECLARATIONS #######                         */
+/*======================================================================================*/
+/*-------------------------------- OTHER TYPEDEFS --------------------------------------*/
+
+/*------------------------------------- ENUMS ------------------------------------------*/
+
+/*------------------------------- STRUCT AND UNIONS ------------------------------------*/
+
+/*======================================================================================*/
+/*                         ####### OBJECT DEFINITIONS #######                           */
+/*======================================================================================*/
+/*--------------------------------- EXPORTED OBJECTS -----------------------------------*/
+
+/*---------------------------------- LOCAL OBJECTS -------------------------------------*/
+/**
+ * @brief   CRCM Test Group.
+ */
+TEST_GROUP(CRCM);
+
+/*======================================================================================*/
+/*                    ####### LOCAL FUNCTIONS PROTOTYPES #######                        */
+/*======================================================================================*/
+
+/*======================================================================================*/
+/*                   ####### LOCAL FUNCTIONS DEFINITIONS #######                        */
+/*======================================================================================*/
+
+/*======================================================================================*/
+/*                        ####### TESTS DEFINITIONS #######                             */
+/*======================================================================================*/
+/**
+ * @brief   Setup Test Environment.
+ */
+TEST_SETUP(CRCM)
+{
+
+}
+
+/**
+ * @brief   Tear Down Test Environment.
+ */
+TEST_TEAR_DOWN(CRCM)
+{
+
+}
+
+TEST(CRCM, CRCM_Catalog_should_MatchCheckValues)
+{
+  CRCM_Engine_T engine;
+
+  for (uint8_t idx = 0; NULL != CRCM_Catalog[idx]; idx++)
+  {
+    TEST_ASSERT_TRUE(CRCM_Init(&engine, CRCM_Catalog[idx]));
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE(CRCM_Catalog[idx]->check, CRCM_Calc(&engine, CHECK_STRING, CHECK_STRING_LENGTH),
+                                    CRCM_Catalog[idx]->name);
+  }
+}
+
+TEST(CRCM, CRCM_Update_should_GiveTheSameCrcAsCalc)
+{
+  CRCM_Engine_T engine;
+
+  for (uint8_t idx = 0; NULL != CRCM_Catalog[idx]; idx++)
+  {
+    CRCM_Init(&engine, CRCM_Catalog[idx]);
+
+    for (size_t split = 0; split <= CHECK_STRING_LENGTH; split++)
+    {
+      uint32_t reg = CRCM_Start(&engine);
+      reg = CRCM_Update(&engine, reg, CHECK_STRING, split);
+      reg = CRCM_Update(&engine, reg, CHECK_STRING + split, CHECK_STRING_LENGTH - split);
+
+      TEST_ASSERT_EQUAL_HEX32_MESSAGE(CRCM_Catalog[idx]->check, CRCM_Finish(&engine, reg), CRCM_Catalog[idx]->name);
+    }
+  }
+}
+
+TEST(CRCM, CRCM_FindModel_should_FindModelsByName)
+{
+  TEST_ASSERT_EQUAL_PTR(&CRCM_CRC16_MODBUS, CRCM_FindModel("CRC-16/MODBUS"));
+  TEST_ASSERT_EQUAL_PTR(&CRCM_CRC32_ISCSI, CRCM_FindModel("CRC-32/ISCSI"));
+  TEST_ASSERT_NULL(CRCM_FindModel("CRC-16/UNKNOWN"));
+}
+
+TEST(CRCM, CRCM_Init_should_RejectNotSupportedWidth)
+{
+  CRCM_Engine_T engine;
+  CRCM_Model_T model = CRCM_CRC32_ISO_HDLC;
+
+  model.width = 0;
+  TEST_ASSERT_FALSE(CRCM_Init(&engine, &model));
+  model.width = 33;
+  TEST_ASSERT_FALSE(CRCM_Init(&engine, &model));
+}
+
+/**
+ * @} end of group TC_CRCM
+ */
@@ -0,0 +1,208 @@
+/*=======================================================================================*
+ * @file    TC_CRCMT.c
+ * @author  Damian Pala
+ * @date    18-10-2026
+ * @brief   This file contains unit tests for CRCMT module.
+ *======================================================================================*/
+
+/**
+ * @addtogroup TC_CRCMT Multi-threaded CRC calculations tests
+ * @{
+ * @brief Unit tests implementation.
+ */
+
+/*======================================================================================*/
+/*                       ####### PREPROCESSOR DIRECTIVES #######                        */
+/*======================================================================================*/
+/*---------------------- INCLUDE DIRECTIVES FOR STANDARD HEADERS -----------------------*/
+
+/*----------------------- INCLUDE DIRECTIVES FOR OTHER HEADERS -------------------------*/
+#include "unity.h"
+#include "unity_fixture.h"
+
+#include "CRCMT.c"
+
+/*----------------------------- LOCAL OBJECT-LIKE MACROS -------------------------------*/
+#define TEST_BUFFER_SIZE              (4 * 1024 * 1024 + 13)
+#define TEST_POOL_JOBS                200
+#define TEST_POOL_QUEUE_SIZE          8
+
+/*---------------------------- LOCAL FUNCTION-LIKE MACROS ------------------------------*/
+
+/*======================================================================================*/
+/*                      ####### LOCAL TYPE DECLARATIONS #######                         */
+/*======================================================================================*/
+/*-------------------------------- OTHER TYPEDEFS --------------------------------------*/
+
+/*------------------------------------- ENUMS ------------------------------------------*/
+
+/*------------------------------- STRUCT AND UNIONS ------------------------------------*/
+
+/*======================================================================================*/
+/*                         ####### OBJECT DEFINITIONS #######                           */
+/*======================================================================================*/
+/*--------------------------------- EXPORTED OBJECTS -----------------------------------*/
+
+/*---------------------------------- LOCAL OBJECTS -------------------------------------*/
+/**
+ * @brief   CRCMT Test Group.
+ */
+TEST_GROUP(CRCMT);
+
+static uint8_t TestBuffer[TEST_BUFFER_SIZE];
+static CRCMT_Job_T TestJobs[TEST_POOL_JOBS];
+static CRCMT_Job_T *TestQueue[TEST_POOL_QUEUE_SIZE];
+static size_t CompletedJobs;
+
+/*======================================================================================*/
+/*                    ####### LOCAL FUNCTIONS PROTOTYPES #######                        */
+/*======================================================================================*/
+static uint32_t CalcSingleThreadCrc(void const *data, size_t dataSize, CRC_CalcSize_T crcSize);
+static void CountCompletedJob(CRCMT_Job_T *job);
+
+/*======================================================================================*/
+/*                   ####### LOCAL FUNCTIONS DEFINITIONS #######                        */
+/*======================================================================================*/
+static uint32_t CalcSingleThreadCrc(void const *data, size_t dataSize, CRC_CalcSize_T crcSize)
+{
+  CRC_Ctx_T ctx;
+
+  CRC_CtxInit(&ctx, crcSize);
+  CRC_CtxUpdate(&ctx, data, dataSize);
+
+  return CRC_CtxFinal(&ctx);
+}
+
+static void CountCompletedJob(CRCMT_Job_T *job)
+{
+  TEST_ASSERT_EQUAL_HEX32(CalcSingleThreadCrc(job->data, job->nBytes, job->crcSize), job->crc);
+  CompletedJobs++;
+}
+
+/*======================================================================================*/
+/*                        ####### TESTS DEFINITIONS #######                             */
+/*======================================================================================*/
+/**
+ * @brief   Setup Test Environment.
+ */
+TEST_SETUP(CRCMT)
+{
+  uint32_t seed = 0x1234;
+
+  for (size_t byteCnt = 0; byteCnt < sizeof(TestBuffer); byteCnt++)
+  {
+    seed = seed * 1103515245 + 12345;
+    TestBuffer[byteCnt] = (uint8_t)(seed >> 16);
+  }
+}
+
+/**
+ * @brief   Tear Down Test Environment.
+ */
+TEST_TEAR_DOWN(CRCMT)
+{
+
+}
+
+/* Test is run before any other CRC calculation, so worker threads are the first users of CRC engine state */
+TEST(CRCMT, CRCMT_Calc_should_BeSafeAsTheFirstCrcCalculationOfProcess)
+{
+  const CRC_CalcSize_T crcSizes[4] = {CRC_CALC_SIZE_32, CRC_CALC_SIZE_32C, CRC_CALC_SIZE_16, CRC_CALC_SIZE_8};
+  uint32_t crc[4];
+
+  for (uint8_t sizeIdx = 0; sizeIdx < 4; sizeIdx++)
+  {
+    crc[sizeIdx] = CRCMT_Calc(crcSizes[sizeIdx], TestBuffer, sizeof(TestBuffer), 8);
+  }
+
+  for (uint8_t sizeIdx = 0; sizeIdx < 4; sizeIdx++)
+  {
+    TEST_ASSERT_EQUAL_HEX32(CalcSingleThreadCrc(TestBuffer, sizeof(TestBuffer), crcSizes[sizeIdx]), crc[sizeIdx]);
+  }
+}
+
+TEST(CRCMT, CRCMT_Calc_should_GiveTheSameCrcAsSingleThread)
+{
+  const CRC_CalcSize_T crcSizes[4] = {CRC_CALC_SIZE_8, CRC_CALC_SIZE_16, CRC_CALC_SIZE_32, CRC_CALC_SIZE_32C};
+  const uint8_t nThreads[] = {0, 1, 2, 3, 7, 16, 255};
+
+  for (uint8_t sizeIdx = 0; sizeIdx < 4; sizeIdx++)
+  {
+    uint32_t crc = CalcSingleThreadCrc(TestBuffer, sizeof(TestBuffer), crcSizes[sizeIdx]);
+
+    for (uint8_t threadsIdx = 0; threadsIdx < sizeof(nThreads); threadsIdx++)
+    {
+      TEST_ASSERT_EQUAL_HEX32(crc, CRCMT_Calc(crcSizes[sizeIdx], TestBuffer, sizeof(TestBuffer), nThreads[threadsIdx]));
+    }
+  }
+}
+
+TEST(CRCMT, CRCMT_Calc_should_CalculateSmallBuffersProperly)
+{
+  const size_t sizes[] = {0, 1, 100, CRCMT_MIN_CHUNK_SIZE - 1, CRCMT_MIN_CHUNK_SIZE + 1, 2 * CRCMT_MIN_CHUNK_SIZE + 5};
+
+  for (uint8_t sizeIdx = 0; sizeIdx < sizeof(sizes) / sizeof(sizes[0]); sizeIdx++)
+  {
+    TEST_ASSERT_EQUAL_HEX32(CalcSingleThreadCrc(TestBuffer, sizes[sizeIdx], CRC_CALC_SIZE_32),
+                            CRCMT_Calc(CRC_CALC_SIZE_32, TestBuffer, sizes[sizeIdx], 4));
+  }
+}
+
+TEST(CRCMT, CRCMT_Pool_should_CompleteAllSubmittedJobs)
+{
+  const CRC_CalcSize_T crcSizes[4] = {CRC_CALC_SIZE_8, CRC_CALC_SIZE_16, CRC_CALC_SIZE_32, CRC_CALC_SIZE_32C};
+  CRCMT_Pool_T pool;
+
+  CompletedJobs = 0;
+  TEST_ASSERT_TRUE(CRCMT_PoolInit(&pool, TestQueue, TEST_POOL_QUEUE_SIZE, 3));
+
+  for (size_t jobIdx = 0; jobIdx < TEST_POOL_JOBS; jobIdx++)
+  {
+    TestJobs[jobIdx].crcSize = crcSizes[jobIdx % 4];
+    TestJobs[jobIdx].data = &TestBuffer[jobIdx * 977];
+    TestJobs[jobIdx].nBytes = (jobIdx * 7919) % (64 * 1024);
+    TestJobs[jobIdx].callback = CountCompletedJob;
+
+    /* Queue is shorter than number of jobs, completions are drained while waiting for free place */
+    while (false == CRCMT_PoolSubmit(&pool, &TestJobs[jobIdx], false))
+    {
+      CRCMT_PoolDrain(&pool, true);
+    }
+  }
+
+  while (0 != CRCMT_PoolGetPendingJobs(&pool))
+  {
+    CRCMT_PoolDrain(&pool, true);
+  }
+
+  TEST_ASSERT_EQUAL(TEST_POOL_JOBS, CompletedJobs);
+  TEST_ASSERT_EQUAL(0, CRCMT_PoolDrain(&pool, true));
+
+  CRCMT_PoolDeinit(&pool);
+}
+
+TEST(CRCMT, CRCMT_PoolDeinit_should_CompleteQueuedJobs)
+{
+  CRCMT_Pool_T pool;
+
+  CompletedJobs = 0;
+  TEST_ASSERT_TRUE(CRCMT_PoolInit(&pool, TestQueue, TEST_POOL_QUEUE_SIZE, 1));
+
+  for (size_t jobIdx = 0; jobIdx < TEST_POOL_JOBS; jobIdx++)
+  {
+    TestJobs[jobIdx].crcSize = CRC_CALC_SIZE_32C;
+    TestJobs[jobIdx].data = TestBuffer;
+    TestJobs[jobIdx].nBytes = jobIdx * 1000;
+    TestJobs[jobIdx].callback = CountCompletedJob;
+
+    TEST_ASSERT_TRUE(CRCMT_PoolSubmit(&pool, &TestJobs[jobIdx], true));
+  }
+
+  CRCMT_PoolDeinit(&pool);
+
+  TEST_ASSERT_EQUAL(TEST_POOL_JOBS, CompletedJobs);
+}
+
+/**
+ * @} end of group TC_CRCMT
+ */
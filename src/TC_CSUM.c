@@ -0,0 +1,182 @@
+/*=======================================================================================*
+ * @file    TC_CSUM.c
+ * @author  Damian Pala
+ * @date    18-10-2026
+ * @brief   This file contains unit tests for CSUM module.
+ *======================================================================================*/
+
+/**
+ * @addtogroup TC_CSUM Checksum calculations tests
+ * @{
+ * @brief Unit tests implementation.
+ */
+
+/*======================================================================================*/
+/*                       ####### PREPROCESSOR DIRECTIVES #######                        */
+/*======================================================================================*/
+/*---------------------- INCLUDE DIRECTIVES FOR STANDARD HEADERS -----------------------*/
+#include <string.h>
+
+/*----------------------- INCLUDE DIRECTIVES FOR OTHER HEADERS -------------------------*/
+#include "unity.h"
+#include "unity_fixture.h"
+
+#include "CSUM.c"
+
+/*----------------------------- LOCAL OBJECT-LIKE MACROS -------------------------------*/
+#define TEST_BUFFER_SIZE              (64 * 1024 + 64)
+#define TEST_MAX_ALIGNMENT            32
+#define TEST_MAX_SHORT_LENGTH         600
+
+/*---------------------------- LOCAL FUNCTION-LIKE MACROS ------------------------------*/
+
+/*======================================================================================*/
+/*                      ####### LOCAL TYPE DECLARATIONS #######                         */
+/*======================================================================================*/
+/*-------------------------------- OTHER TYPEDEFS --------------------------------------*/
+
+/*------------------------------------- ENUMS ------------------------------------------*/
+
+/*------------------------------- STRUCT AND UNIONS ------------------------------------*/
+
+/*======================================================================================*/
+/*                         ####### OBJECT DEFINITIONS #######                           */
+/*======================================================================================*/
+/*--------------------------------- EXPORTED OBJECTS -----------------------------------*/
+
+/*---------------------------------- LOCAL OBJECTS -------------------------------------*/
+/**
+ * @brief   CSUM Test Group.
+ */
+TEST_GROUP(CSUM);
+
+static uint8_t TestBuffer[TEST_BUFFER_SIZE];
+
+/*======================================================================================*/
+/*                    ####### LOCAL FUNCTIONS PROTOTYPES #######                        */
+/*======================================================================================*/
+static uint32_t CalcReferenceAdler32(uint8_t const *data, size_t nBytes);
+static uint32_t CalcReferenceFletcher32(uint8_t const *data, size_t nBytes);
+
+/*======================================================================================*/
+/*                   ####### LOCAL FUNCTIONS DEFINITIONS #######                        */
+/*======================================================================================*/
+/* Sums are reduced after every byte, so the reference does not depend on deferred reduction */
+static uint32_t CalcReferenceAdler32(uint8_t const *data, size_t nBytes)
+{
+  uint32_t sum1 = 1;
+  uint32_t sum2 = 0;
+
+  for (size_t byte = 0; byte < nBytes; byte++)
+  {
+    sum1 = (sum1 + data[byte]) % 65521;
+    sum2 = (sum2 + sum1) % 65521;
+  }
+
+  return ((sum2 << 16) | sum1);
+}
+
+static uint32_t CalcReferenceFletcher32(uint8_t const *data, size_t nBytes)
+{
+  uint32_t sum1 = 0;
+  uint32_t sum2 = 0;
+
+  for (size_t byte = 0; byte < nBytes; byte += 2)
+  {
+    uint32_t word = data[byte];
+
+    if (byte + 1 < nBytes)
+    {
+      word |= (uint32_t)data[byte + 1] << 8;
+    }
+
+    sum1 = (sum1 + word) % 65535;
+    sum2 = (sum2 + sum1) % 65535;
+  }
+
+  return ((sum2 << 16) | sum1);
+}
+
+/*======================================================================================*/
+/*                        ####### TESTS DEFINITIONS #######                             */
+/*======================================================================================*/
+/**
+ * @brief   Setup Test Environment.
+ */
+TEST_SETUP(CSUM)
+{
+  uint32_t seed = 0x12345678;
+
+  for (size_t idx = 0; idx < TEST_BUFFER_SIZE; idx++)
+  {
+    seed = seed * 1103515245 + 12345;
+    TestBuffer[idx] = (uint8_t)(seed >> 16);
+  }
+}
+
+/**
+ * @brief   Tear Down Test Environment.
+ */
+TEST_TEAR_DOWN(CSUM)
+{
+
+}
+
+TEST(CSUM, CSUM_should_MatchKnownValues)
+{
+  TEST_ASSERT_EQUAL_HEX32(0x00000001, CSUM_CalcAdler32((uint8_t const*)"", 0));
+  TEST_ASSERT_EQUAL_HEX32(0x024D0127, CSUM_CalcAdler32((uint8_t const*)"abc", 3));
+  TEST_ASSERT_EQUAL_HEX32(0x11E60398, CSUM_CalcAdler32((uint8_t const*)"Wikipedia", 9));
+
+  TEST_ASSERT_EQUAL_HEX32(0x00000000, CSUM_CalcFletcher32((uint8_t const*)"", 0));
+  TEST_ASSERT_EQUAL_HEX32(0xF04FC729, CSUM_CalcFletcher32((uint8_t const*)"abcde", 5));
+  TEST_ASSERT_EQUAL_HEX32(0x56502D2A, CSUM_CalcFletcher32((uint8_t const*)"abcdef", 6));
+  TEST_ASSERT_EQUAL_HEX32(0xEBE19591, CSUM_CalcFletcher32((uint8_t const*)"abcdefgh", 8));
+}
+
+TEST(CSUM, CSUM_should_MatchReferenceForEveryLengthAndAlignment)
+{
+  for (size_t alignment = 0; alignment < TEST_MAX_ALIGNMENT; alignment++)
+  {
+    for (size_t length = 0; length <= TEST_MAX_SHORT_LENGTH; length++)
+    {
+      uint8_t const *data = &TestBuffer[alignment];
+
+      TEST_ASSERT_EQUAL_HEX32(CalcReferenceAdler32(data, length), CSUM_CalcAdler32(data, length));
+      TEST_ASSERT_EQUAL_HEX32(CalcReferenceFletcher32(data, length), CSUM_CalcFletcher32(data, length));
+    }
+  }
+}
+
+TEST(CSUM, CSUM_should_NotOverflowOnLongBuffersOfMaximalBytes)
+{
+  size_t const length = TEST_BUFFER_SIZE - 1;
+
+  TEST_ASSERT_EQUAL_HEX32(CalcReferenceAdler32(TestBuffer, length), CSUM_CalcAdler32(TestBuffer, length));
+  TEST_ASSERT_EQUAL_HEX32(CalcReferenceFletcher32(TestBuffer, length), CSUM_CalcFletcher32(TestBuffer, length));
+
+  memset(TestBuffer, 0xFF, TEST_BUFFER_SIZE);
+
+  TEST_ASSERT_EQUAL_HEX32(CalcReferenceAdler32(TestBuffer, length), CSUM_CalcAdler32(TestBuffer, length));
+  TEST_ASSERT_EQUAL_HEX32(CalcReferenceFletcher32(TestBuffer, length), CSUM_CalcFletcher32(TestBuffer, length));
+}
+
+TEST(CSUM, CSUM_UpdateAdler32_should_GiveTheSameChecksumAsCalc)
+{
+  size_t const length = 4 * 1024;
+  uint32_t expected = CSUM_CalcAdler32(TestBuffer, length);
+
+  for (size_t split = 0; split <= length; split += 97)
+  {
+    uint32_t adler = CSUM_ADLER32_INITIAL_VALUE;
+
+    adler = CSUM_UpdateAdler32(adler, TestBuffer, split);
+    adler = CSUM_UpdateAdler32(adler, &TestBuffer[split], length - split);
+
+    TEST_ASSERT_EQUAL_HEX32(expected, adler);
+  }
+}
+
+/**
+ * @} end of group TC_CSUM
+ */
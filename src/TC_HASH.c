@@ -0,0 +1,191 @@
+/*=======================================================================================*
+ * @file    TC_HASH.c
+ * @author  Damian Pala
+ * @date    18-10-2026
+ * @brief   This file contains unit tests for HASH module.
+ *======================================================================================*/
+
+/**
+ * @addtogroup TC_HASH Hashing tests
+ * @{
+ * @brief Unit tests implementation.
+ */
+
+/*======================================================================================*/
+/*                       ####### PREPROCESSOR DIRECTIVES #######                        */
+/*======================================================================================*/
+/*---------------------- INCLUDE DIRECTIVES FOR STANDARD HEADERS -----------------------*/
+#include <string.h>
+
+/*----------------------- INCLUDE DIRECTIVES FOR OTHER HEADERS -------------------------*/
+#include "unity.h"
+#include "unity_fixture.h"
+
+#include "HASH.c"
+
+/*----------------------------- LOCAL OBJECT-LIKE MACROS -------------------------------*/
+#define TEST_BUFFER_SIZE              8192
+#define TEST_SEED32                   0x9E3779B1
+#define TEST_SEED64                   0x0123456789ABCDEFULL
+#define TEST_MAX_ALIGNMENT            16
+
+/*---------------------------- LOCAL FUNCTION-LIKE MACROS ------------------------------*/
+
+/*======================================================================================*/
+/*                      ####### LOCAL TYPE DECLARATIONS #######                         */
+/*======================================================================================*/
+/*-------------------------------- OTHER TYPEDEFS --------------------------------------*/
+
+/*------------------------------------- ENUMS ------------------------------------------*/
+
+/*------------------------------- STRUCT AND UNIONS ------------------------------------*/
+/** Hashes of the reference xxHash library for the first length bytes of TestBuffer */
+typedef struct HASH_TestVector_Tag
+{
+  size_t length;
+  uint32_t hash32;
+  uint32_t hash32Seeded;
+  uint64_t hash64;
+  uint64_t hash64Seeded;
+} HASH_TestVector_T;
+
+/*======================================================================================*/
+/*                         ####### OBJECT DEFINITIONS #######                           */
+/*======================================================================================*/
+/*--------------------------------- EXPORTED OBJECTS -----------------------------------*/
+
+/*---------------------------------- LOCAL OBJECTS -------------------------------------*/
+/**
+ * @brief   HASH Test Group.
+ */
+TEST_GROUP(HASH);
+
+static uint8_t TestBuffer[TEST_BUFFER_SIZE + TEST_MAX_ALIGNMENT];
+
+static const HASH_TestVector_T HASH_TestVectors[] =
+{
+  {   0, 0x02CC5D05, 0x36B78AE7, 0x2D06800538D394C2ULL, 0xCC1CA35A1B089C5CULL},
+  {   1, 0xA11F6F39, 0x70041E84, 0xF2386670CFF0B396ULL, 0x73F68C7E74A40522ULL},
+  {   3, 0x894823CE, 0x9EC74F33, 0xC61B62D548445F86ULL, 0xAF7E8E12F3A40F37ULL},
+  {   4, 0x951CE9FD, 0xC24EA603, 0xF19AB173417737BFULL, 0xA89AD1D362788F14ULL},
+  {   8, 0x4F36577E, 0xBAF904DE, 0xEAFC1D751E6B1584ULL, 0x01ABC1B3B3EF0B5BULL},
+  {   9, 0x6350FF3A, 0xCD2BB95B, 0x8EC6F032117277A9ULL, 0xE24156E21892F5BFULL},
+  {  16, 0x069222F3, 0x509738F6, 0x2D856F37DC756502ULL, 0xFC9CC18D53859E81ULL},
+  {  17, 0x3792B30E, 0x0479F95C, 0xA3115A16D3FCE177ULL, 0xD22A0A2C97E7BB37ULL},
+  {  31, 0xC69EDEDF, 0x08BEFAF3, 0xAD0A1FB551FEA8E2ULL, 0x48C1E1185B4DDD0CULL},
+  {  32, 0xEFB370C8, 0x8B650A56, 0x8882E301CFCF5029ULL, 0x3EC200D4CE7619F1ULL},
+  {  33, 0x6BA93FA8, 0xDDE2DF34, 0x97121F11E29CF776ULL, 0x7265935F3B90C7FCULL},
+  {  64, 0xD07AE7CB, 0xD643CD67, 0x3426C018D730966EULL, 0x24E2AB848F8D86DAULL},
+  {  65, 0x1687B75A, 0x3948B54B, 0x9DBB45CA093E3543ULL, 0xD30C8B9FB58A9601ULL},
+  {  96, 0xD959ECAD, 0x73414CC6, 0x1E114072D0C855F0ULL, 0x1163CDD0276E0867ULL},
+  {  97, 0x84630A86, 0xA88893D1, 0x649B3141D5045B89ULL, 0x5194DDE428C32423ULL},
+  { 128, 0x9033DBC4, 0xB22865B7, 0x634E84AAFC9D9C38ULL, 0x49E1D510C9C87703ULL},
+  { 129, 0x220B2C01, 0xFAFF7338, 0x8717C9D0BC8F3428ULL, 0x9827D7B6625D0EBEULL},
+  { 200, 0x8F940426, 0xD119597C, 0x2284AB05B3355B37ULL, 0xFE2DA2C02BD9DAF8ULL},
+  { 240, 0xB89A997D, 0x7C64BC52, 0x4E24EA1BDAD4256EULL, 0xF9B3297CFEBB71CBULL},
+  { 241, 0x0CB92A90, 0x6BCA6D38, 0xFFF5CB6173C21DB3ULL, 0x670421C1A413665BULL},
+  { 256, 0x87C47075, 0x52B7E9A1, 0x7C38202CCCB15295ULL, 0xAA3251FA1307DEA1ULL},
+  {1023, 0xC70A5A3C, 0xF443A096, 0x1110E85DFF9B3C63ULL, 0xC8BF39AC99595C27ULL},
+  {1024, 0x4D88671C, 0x545689DE, 0xE665714672B7CD0BULL, 0x876CA9351449D5C8ULL},
+  {1025, 0x0DFC2D83, 0x411F6095, 0x92EC889150E4180CULL, 0xC9E9A148FA3B4E87ULL},
+  {4096, 0x8FC44276, 0x10934973, 0x5FE8FB4C8A5E291CULL, 0x6816A9FDF69EF0F2ULL},
+  {8191, 0xDC1A813C, 0xB21091DA, 0x22ABB000B5672B45ULL, 0x9F7EE3BC12D98021ULL}
+};
+
+static const size_t HASH_TestChunkSizes[] = {1, 3, 7, 16, 63, 64, 65, 255, 256, 257, 1000, TEST_BUFFER_SIZE};
+
+/*======================================================================================*/
+/*                    ####### LOCAL FUNCTIONS PROTOTYPES #######                        */
+/*======================================================================================*/
+
+/*======================================================================================*/
+/*                   ####### LOCAL FUNCTIONS DEFINITIONS #######                        */
+/*======================================================================================*/
+
+/*======================================================================================*/
+/*                        ####### TESTS DEFINITIONS #######                             */
+/*======================================================================================*/
+/**
+ * @brief   Setup Test Environment.
+ */
+TEST_SETUP(HASH)
+{
+  uint32_t seed = 0x12345678;
+
+  for (size_t idx = 0; idx < TEST_BUFFER_SIZE; idx++)
+  {
+    seed = seed * 1103515245 + 12345;
+    TestBuffer[idx] = (uint8_t)(seed >> 16);
+  }
+}
+
+/**
+ * @brief   Tear Down Test Environment.
+ */
+TEST_TEAR_DOWN(HASH)
+{
+
+}
+
+TEST(HASH, HASH_should_MatchReferenceImplementation)
+{
+  for (size_t idx = 0; idx < sizeof(HASH_TestVectors) / sizeof(HASH_TestVectors[0]); idx++)
+  {
+    HASH_TestVector_T const *vector = &HASH_TestVectors[idx];
+
+    TEST_ASSERT_EQUAL_HEX32(vector->hash32, HASH_Calc32(TestBuffer, vector->length, 0));
+    TEST_ASSERT_EQUAL_HEX32(vector->hash32Seeded, HASH_Calc32(TestBuffer, vector->length, TEST_SEED32));
+    TEST_ASSERT_TRUE(vector->hash64 == HASH_Calc64(TestBuffer, vector->length, 0));
+    TEST_ASSERT_TRUE(vector->hash64Seeded == HASH_Calc64(TestBuffer, vector->length, TEST_SEED64));
+  }
+}
+
+TEST(HASH, HASH_Ctx_should_GiveTheSameHashAsCalcForAnySplit)
+{
+  for (size_t idx = 0; idx < sizeof(HASH_TestVectors) / sizeof(HASH_TestVectors[0]); idx++)
+  {
+    HASH_TestVector_T const *vector = &HASH_TestVectors[idx];
+
+    for (size_t chunkIdx = 0; chunkIdx < sizeof(HASH_TestChunkSizes) / sizeof(HASH_TestChunkSizes[0]); chunkIdx++)
+    {
+      HASH_Ctx32_T ctx32;
+      HASH_Ctx64_T ctx64;
+
+      HASH_Ctx32Init(&ctx32, TEST_SEED32);
+      HASH_Ctx64Init(&ctx64, TEST_SEED64);
+
+      for (size_t offset = 0; offset < vector->length; offset += HASH_TestChunkSizes[chunkIdx])
+      {
+        size_t nBytes = vector->length - offset;
+
+        if (nBytes > HASH_TestChunkSizes[chunkIdx])
+        {
+          nBytes = HASH_TestChunkSizes[chunkIdx];
+        }
+
+        HASH_Ctx32Update(&ctx32, &TestBuffer[offset], nBytes);
+        HASH_Ctx64Update(&ctx64, &TestBuffer[offset], nBytes);
+      }
+
+      TEST_ASSERT_EQUAL_HEX32(vector->hash32Seeded, HASH_Ctx32Final(&ctx32));
+      TEST_ASSERT_TRUE(vector->hash64Seeded == HASH_Ctx64Final(&ctx64));
+    }
+  }
+}
+
+TEST(HASH, HASH_should_NotDependOnDataAlignment)
+{
+  HASH_TestVector_T const *vector = &HASH_TestVectors[sizeof(HASH_TestVectors) / sizeof(HASH_TestVectors[0]) - 1];
+
+  for (size_t alignment = 1; alignment < TEST_MAX_ALIGNMENT; alignment++)
+  {
+    memmove(&TestBuffer[1], TestBuffer, TEST_BUFFER_SIZE + TEST_MAX_ALIGNMENT - 1);
+
+    TEST_ASSERT_EQUAL_HEX32(vector->hash32, HASH_Calc32(&TestBuffer[alignment], vector->length, 0));
+    TEST_ASSERT_TRUE(vector->hash64 == HASH_Calc64(&TestBuffer[alignment], vector->length, 0));
+  }
+}
+
+/**
+ * @} end of group TC_HASH
+ */
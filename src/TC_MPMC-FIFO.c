@@ -0,0 +1,229 @@
+/*=======================================================================================*
+ * @file    TC_MPMC-FIFO.c
+ * @author  Damian Pala
+ * @date    18-10-2026
+ * @brief   This file contains unit tests for MPMC-FIFO module.
+ *======================================================================================*/
+
+/**
+ * @addtogroup TC_MPMC-FIFO Lock-free MPMC FIFO Queue unit tests
+ * @{
+ * @brief Unit tests implementation.
+ */
+
+/*======================================================================================*/
+/*                       ####### PREPROCESSOR DIRECTIVES #######                        */
+/*======================================================================================*/
+/*---------------------- INCLUDE DIRECTIVES FOR STANDARD HEADERS -----------------------*/
+#include <pthread.h>
+#include <sched.h>
+
+/*----------------------- INCLUDE DIRECTIVES FOR OTHER HEADERS -------------------------*/
+#include "unity.h"
+#include "unity_fixture.h"
+
+#include "MPMC-FIFO.c"
+
+/*----------------------------- LOCAL OBJECT-LIKE MACROS -------------------------------*/
+#define TEST_PRODUCERS                4
+#define TEST_CONSUMERS                3
+#define TEST_ITEMS_PER_PRODUCER       200000
+
+/*---------------------------- LOCAL FUNCTION-LIKE MACROS ------------------------------*/
+
+/*======================================================================================*/
+/*                      ####### LOCAL TYPE DECLARATIONS #######                         */
+/*======================================================================================*/
+/*-------------------------------- OTHER TYPEDEFS --------------------------------------*/
+
+/*------------------------------------- ENUMS ------------------------------------------*/
+
+/*------------------------------- STRUCT AND UNIONS ------------------------------------*/
+typedef struct TestItem_Tag
+{
+  uint32_t producer;
+  uint32_t sequence;
+} TestItem_T;
+
+typedef struct TestConsumer_Tag
+{
+  uint32_t nReceived[TEST_PRODUCERS];   ///< Number of items received from every producer
+  bool isOrdered;                       ///< Items of every producer were received in order
+} TestConsumer_T;
+
+/*======================================================================================*/
+/*                         ####### OBJECT DEFINITIONS #######                           */
+/*======================================================================================*/
+/*--------------------------------- EXPORTED OBJECTS -----------------------------------*/
+
+/*---------------------------------- LOCAL OBJECTS -------------------------------------*/
+/**
+ * @brief   MPMCFIFO Test Group.
+ */
+TEST_GROUP(MPMCFIFO);
+
+MPMCFIFO_Create(SharedFifo, sizeof(TestItem_T), 64);
+
+static _Atomic uint32_t TotalReceived;
+
+/*======================================================================================*/
+/*                    ####### LOCAL FUNCTIONS PROTOTYPES #######                        */
+/*======================================================================================*/
+static void* ProduceItems(void *pProducer);
+static void* ConsumeItems(void *pConsumer);
+
+/*======================================================================================*/
+/*                   ####### LOCAL FUNCTIONS DEFINITIONS #######                        */
+/*======================================================================================*/
+static void* ProduceItems(void *pProducer)
+{
+  TestItem_T item = {*(uint32_t*)pProducer, 0};
+
+  for (item.sequence = 0; item.sequence < TEST_ITEMS_PER_PRODUCER; item.sequence++)
+  {
+    while (false == MPMCFIFO_PushItem(SharedFifo, &item))
+    {
+      sched_yield();
+    }
+  }
+
+  return NULL;
+}
+
+/* Items of one producer are popped in order of pushing, so each consumer sees growing sequences */
+static void* ConsumeItems(void *pConsumer)
+{
+  TestConsumer_T *consumer = (TestConsumer_T*)pConsumer;
+  uint32_t lastSequence[TEST_PRODUCERS] = {0};
+  TestItem_T item;
+
+  consumer->isOrdered = true;
+
+  while (atomic_load(&TotalReceived) < TEST_PRODUCERS * TEST_ITEMS_PER_PRODUCER)
+  {
+    if (false == MPMCFIFO_PopItem(SharedFifo, &item))
+    {
+      sched_yield();
+      continue;
+    }
+
+    if ( (0 != consumer->nReceived[item.producer]) && (item.sequence <= lastSequence[item.producer]) )
+    {
+      consumer->isOrdered = false;
+    }
+
+    lastSequence[item.producer] = item.sequence;
+    consumer->nReceived[item.producer]++;
+    atomic_fetch_add(&TotalReceived, 1);
+  }
+
+  return NULL;
+}
+
+/*======================================================================================*/
+/*                        ####### TESTS DEFINITIONS #######                             */
+/*======================================================================================*/
+/**
+ * @brief   Setup Test Environment.
+ */
+TEST_SETUP(MPMCFIFO)
+{
+
+}
+
+/**
+ * @brief   Tear Down Test Environment.
+ */
+TEST_TEAR_DOWN(MPMCFIFO)
+{
+
+}
+
+TEST(MPMCFIFO, MPMCFIFO_should_PushAndPopAndCountItemsProperlyAfterManyWraparounds)
+{
+  enum {ITEM_NUMBER = 4};
+  uint32_t pushedItem = 0;
+  uint32_t poppedItem = 0;
+
+  MPMCFIFO_Create(myFifo, sizeof(uint32_t), ITEM_NUMBER);
+
+  for (uint16_t round = 0; round < 4 * ITEM_NUMBER + 1; round++)
+  {
+    uint16_t nItems = (uint16_t)(round % (ITEM_NUMBER + 1));
+
+    TEST_ASSERT_EQUAL_UINT16(0, MPMCFIFO_GetItemsInFifo(myFifo));
+    TEST_ASSERT_FALSE(MPMCFIFO_PopItem(myFifo, &poppedItem));
+
+    for (uint16_t item = 0; item < nItems; item++)
+    {
+      pushedItem++;
+      TEST_ASSERT_TRUE(MPMCFIFO_PushItem(myFifo, &pushedItem));
+      TEST_ASSERT_EQUAL_UINT16(item + 1, MPMCFIFO_GetItemsInFifo(myFifo));
+    }
+
+    if (ITEM_NUMBER == nItems)
+    {
+      TEST_ASSERT_FALSE(MPMCFIFO_PushItem(myFifo, &pushedItem));
+    }
+
+    for (uint16_t item = nItems; item > 0; item--)
+    {
+      TEST_ASSERT_TRUE(MPMCFIFO_PopItem(myFifo, &poppedItem));
+      TEST_ASSERT_EQUAL_HEX32(pushedItem - item + 1, poppedItem);
+    }
+  }
+}
+
+TEST(MPMCFIFO, MPMCFIFO_should_TransferAllItemsBetweenManyThreads)
+{
+  static uint32_t producerIds[TEST_PRODUCERS];
+  static TestConsumer_T consumers[TEST_CONSUMERS];
+  pthread_t producers[TEST_PRODUCERS];
+  pthread_t consumerThreads[TEST_CONSUMERS];
+
+  atomic_store(&TotalReceived, 0);
+
+  for (uint32_t consumer = 0; consumer < TEST_CONSUMERS; consumer++)
+  {
+    TEST_ASSERT_EQUAL(0, pthread_create(&consumerThreads[consumer], NULL, ConsumeItems, &consumers[consumer]));
+  }
+
+  for (uint32_t producer = 0; producer < TEST_PRODUCERS; producer++)
+  {
+    producerIds[producer] = producer;
+    TEST_ASSERT_EQUAL(0, pthread_create(&producers[producer], NULL, ProduceItems, &producerIds[producer]));
+  }
+
+  for (uint32_t producer = 0; producer < TEST_PRODUCERS; producer++)
+  {
+    pthread_join(producers[producer], NULL);
+  }
+
+  for (uint32_t consumer = 0; consumer < TEST_CONSUMERS; consumer++)
+  {
+    pthread_join(consumerThreads[consumer], NULL);
+  }
+
+  for (uint32_t producer = 0; producer < TEST_PRODUCERS; producer++)
+  {
+    uint32_t nReceived = 0;
+
+    for (uint32_t consumer = 0; consumer < TEST_CONSUMERS; consumer++)
+    {
+      nReceived += consumers[consumer].nReceived[producer];
+    }
+
+    TEST_ASSERT_EQUAL_UINT32(TEST_ITEMS_PER_PRODUCER, nReceived);
+  }
+
+  for (uint32_t consumer = 0; consumer < TEST_CONSUMERS; consumer++)
+  {
+    TEST_ASSERT_TRUE(consumers[consumer].isOrdered);
+  }
+
+  TEST_ASSERT_EQUAL_UINT16(0, MPMCFIFO_GetItemsInFifo(SharedFifo));
+}
+
+/**
+ * @} end of group TC_MPMC-FIFO
+ */
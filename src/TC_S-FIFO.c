@@ -15,6 +15,7 @@
 /*                       ####### PREPROCESSOR DIRECTIVES #######                        */
 /*======================================================================================*/
 /*---------------------- INCLUDE DIRECTIVES FOR STANDARD HEADERS -----------------------*/
+#include <string.h>
 
 /*----------------------- INCLUDE DIRECTIVES FOR OTHER HEADERS -------------------------*/
 #include "unity.h"
@@ -863,6 +864,180 @@ TEST(FIFO, SFIFO_UpdateLastItem_should_UpdateLastItemProperlyInVariousSimpleCase
   TEST_ASSERT_EQUAL_HEX32(itemUpdate, itemToGet);
 }
 
+TEST(FIFO, SFIFO_PushItems_should_PushOnlyItemsWhichFitWhenNotOverwriting)
+{
+  enum {ITEM_SIZE = 4};
+  enum {ITEM_NUMBER = 6};
+  uint32_t items[ITEM_NUMBER + 3] = {1, 2, 3, 4, 5, 6, 7, 8, 9};
+  uint32_t poppedItems[ITEM_NUMBER + 3] = {0};
+
+  SFIFO_Create(myFifo, ITEM_SIZE, ITEM_NUMBER);
+  SFIFO_OverwriteLastItems(myFifo, false);
+
+  TEST_ASSERT_EQUAL_UINT16(0, SFIFO_PopItems(myFifo, poppedItems, 3));
+  TEST_ASSERT_EQUAL_UINT16(4, SFIFO_PushItems(myFifo, items, 4));
+  TEST_ASSERT_EQUAL_UINT16(3, SFIFO_PopItems(myFifo, poppedItems, 3));
+  TEST_ASSERT_EQUAL_HEX32_ARRAY(items, poppedItems, 3);
+
+  /* 1 item left at index 3, next 5 items wrap around */
+  TEST_ASSERT_EQUAL_UINT16(5, SFIFO_PushItems(myFifo, &items[4], ITEM_NUMBER + 3 - 4));
+  TEST_ASSERT_TRUE(SFIFO_IsFull(myFifo));
+  TEST_ASSERT_EQUAL_UINT16(0, SFIFO_PushItems(myFifo, items, 1));
+
+  TEST_ASSERT_EQUAL_UINT16(ITEM_NUMBER, SFIFO_PopItems(myFifo, poppedItems, ITEM_NUMBER + 3));
+  TEST_ASSERT_EQUAL_HEX32_ARRAY(&items[3], poppedItems, ITEM_NUMBER);
+  TEST_ASSERT_TRUE(SFIFO_IsEmpty(myFifo));
+}
+
+TEST(FIFO, SFIFO_PushItemsAndPopItems_should_WorkAsSinglePushesAndPops)
+{
+  enum {ITEM_SIZE = 4};
+  enum {ITEM_NUMBER = 7};
+  uint32_t items[3 * ITEM_NUMBER];
+  uint32_t poppedItems[3 * ITEM_NUMBER];
+  uint32_t expectedItem;
+  uint32_t nextItem = 0;
+
+  SFIFO_Create(myFifo, ITEM_SIZE, ITEM_NUMBER);
+  SFIFO_Create(referenceFifo, ITEM_SIZE, ITEM_NUMBER);
+
+  for (uint16_t round = 0; round < 200; round++)
+  {
+    bool overwrite = (0 != (round & 0x10));
+    uint16_t nPushed = (uint16_t)((round * 5) % (3 * ITEM_NUMBER));
+    uint16_t nPopped = (uint16_t)((round * 3) % (2 * ITEM_NUMBER));
+    uint16_t nExpected = 0;
+
+    SFIFO_OverwriteLastItems(myFifo, overwrite);
+    SFIFO_OverwriteLastItems(referenceFifo, overwrite);
+
+    for (uint16_t item = 0; item < nPushed; item++)
+    {
+      items[item] = nextItem++;
+      nExpected += (true == SFIFO_PushItem(referenceFifo, &items[item])) ? 1 : 0;
+    }
+
+    TEST_ASSERT_EQUAL_UINT16(nExpected, SFIFO_PushItems(myFifo, items, nPushed));
+    TEST_ASSERT_EQUAL_UINT16(SFIFO_GetItemsInFifo(referenceFifo), SFIFO_GetItemsInFifo(myFifo));
+    TEST_ASSERT_EQUAL_UINT16(referenceFifo->head, myFifo->head);
+    TEST_ASSERT_EQUAL_UINT16(referenceFifo->tail, myFifo->tail);
+
+    nExpected = (nPopped < SFIFO_GetItemsInFifo(referenceFifo)) ? nPopped : SFIFO_GetItemsInFifo(referenceFifo);
+    TEST_ASSERT_EQUAL_UINT16(nExpected, SFIFO_PopItems(myFifo, poppedItems, nPopped));
+
+    for (uint16_t item = 0; item < nExpected; item++)
+    {
+      TEST_ASSERT_TRUE(SFIFO_PopItem(referenceFifo, &expectedItem));
+      TEST_ASSERT_EQUAL_HEX32(expectedItem, poppedItems[item]);
+    }
+
+    TEST_ASSERT_EQUAL_UINT16(SFIFO_GetItemsInFifo(referenceFifo), SFIFO_GetItemsInFifo(myFifo));
+    TEST_ASSERT_EQUAL_UINT16(referenceFifo->head, myFifo->head);
+    TEST_ASSERT_EQUAL_UINT16(referenceFifo->tail, myFifo->tail);
+  }
+}
+
+TEST(FIFO, SFIFO_ReserveWrite_should_ReturnFreePlacesWhichAreCommittedInOrder)
+{
+  enum {ITEM_SIZE = 4};
+  enum {ITEM_NUMBER = 8};
+  SFIFO_Span_T spans[2];
+  uint32_t item = 0;
+  uint32_t poppedItem;
+
+  SFIFO_Create(myFifo, ITEM_SIZE, ITEM_NUMBER);
+
+  TEST_ASSERT_EQUAL_UINT16(ITEM_NUMBER, SFIFO_ReserveWrite(myFifo, spans));
+  TEST_ASSERT_EQUAL_PTR(myFifo->buffer, spans[0].pData);
+  TEST_ASSERT_EQUAL_UINT16(ITEM_NUMBER, spans[0].nItems);
+  TEST_ASSERT_EQUAL_UINT16(0, spans[1].nItems);
+
+  for (item = 0; item < 5; item++)
+  {
+    memcpy(&spans[0].pData[item * ITEM_SIZE], &item, ITEM_SIZE);
+  }
+  TEST_ASSERT_TRUE(SFIFO_CommitWrite(myFifo, 5));
+  TEST_ASSERT_EQUAL_UINT16(5, SFIFO_GetItemsInFifo(myFifo));
+
+  TEST_ASSERT_TRUE(SFIFO_PopItem(myFifo, &poppedItem));
+  TEST_ASSERT_TRUE(SFIFO_PopItem(myFifo, &poppedItem));
+
+  /* Items 2, 3 and 4 are at indices 2 to 4, free places wrap around */
+  TEST_ASSERT_EQUAL_UINT16(5, SFIFO_ReserveWrite(myFifo, spans));
+  TEST_ASSERT_EQUAL_PTR(&myFifo->buffer[5 * ITEM_SIZE], spans[0].pData);
+  TEST_ASSERT_EQUAL_UINT16(3, spans[0].nItems);
+  TEST_ASSERT_EQUAL_PTR(myFifo->buffer, spans[1].pData);
+  TEST_ASSERT_EQUAL_UINT16(2, spans[1].nItems);
+
+  for (uint16_t spanItem = 0; spanItem < spans[0].nItems; spanItem++, item++)
+  {
+    memcpy(&spans[0].pData[spanItem * ITEM_SIZE], &item, ITEM_SIZE);
+  }
+  for (uint16_t spanItem = 0; spanItem < spans[1].nItems; spanItem++, item++)
+  {
+    memcpy(&spans[1].pData[spanItem * ITEM_SIZE], &item, ITEM_SIZE);
+  }
+
+  TEST_ASSERT_FALSE(SFIFO_CommitWrite(myFifo, 6));
+  TEST_ASSERT_TRUE(SFIFO_CommitWrite(myFifo, 5));
+  TEST_ASSERT_TRUE(SFIFO_IsFull(myFifo));
+  TEST_ASSERT_EQUAL_UINT16(0, SFIFO_ReserveWrite(myFifo, spans));
+
+  TEST_ASSERT_TRUE(SFIFO_GetLastPushedItem(myFifo, &poppedItem));
+  TEST_ASSERT_EQUAL_HEX32(item - 1, poppedItem);
+
+  for (uint32_t expectedItem = 2; expectedItem < item; expectedItem++)
+  {
+    TEST_ASSERT_TRUE(SFIFO_PopItem(myFifo, &poppedItem));
+    TEST_ASSERT_EQUAL_HEX32(expectedItem, poppedItem);
+  }
+  TEST_ASSERT_TRUE(SFIFO_IsEmpty(myFifo));
+}
+
+TEST(FIFO, SFIFO_PeekRead_should_ReturnItemsInPlaceUntilTheyAreConsumed)
+{
+  enum {ITEM_SIZE = 4};
+  enum {ITEM_NUMBER = 6};
+  uint32_t items[ITEM_NUMBER + 2] = {10, 11, 12, 13, 14, 15, 16, 17};
+  SFIFO_Span_T spans[2];
+
+  SFIFO_Create(myFifo, ITEM_SIZE, ITEM_NUMBER);
+  SFIFO_OverwriteLastItems(myFifo, true);
+
+  TEST_ASSERT_EQUAL_UINT16(0, SFIFO_PeekRead(myFifo, spans));
+  TEST_ASSERT_EQUAL_UINT16(0, spans[0].nItems);
+  TEST_ASSERT_EQUAL_UINT16(0, spans[1].nItems);
+  TEST_ASSERT_FALSE(SFIFO_Consume(myFifo, 1));
+
+  /* Items 10 and 11 are overwritten, the oldest item 12 is at index 2 */
+  TEST_ASSERT_EQUAL_UINT16(ITEM_NUMBER + 2, SFIFO_PushItems(myFifo, items, ITEM_NUMBER + 2));
+
+  TEST_ASSERT_EQUAL_UINT16(ITEM_NUMBER, SFIFO_PeekRead(myFifo, spans));
+  TEST_ASSERT_EQUAL_PTR(&myFifo->buffer[2 * ITEM_SIZE], spans[0].pData);
+  TEST_ASSERT_EQUAL_UINT16(4, spans[0].nItems);
+  TEST_ASSERT_EQUAL_PTR(myFifo->buffer, spans[1].pData);
+  TEST_ASSERT_EQUAL_UINT16(2, spans[1].nItems);
+  TEST_ASSERT_EQUAL_MEMORY(&items[2], spans[0].pData, 4 * ITEM_SIZE);
+  TEST_ASSERT_EQUAL_MEMORY(&items[6], spans[1].pData, 2 * ITEM_SIZE);
+
+  /* Peek does not remove items */
+  TEST_ASSERT_EQUAL_UINT16(ITEM_NUMBER, SFIFO_PeekRead(myFifo, spans));
+  TEST_ASSERT_FALSE(SFIFO_Consume(myFifo, ITEM_NUMBER + 1));
+  TEST_ASSERT_TRUE(SFIFO_Consume(myFifo, 5));
+  TEST_ASSERT_FALSE(SFIFO_IsFull(myFifo));
+
+  TEST_ASSERT_EQUAL_UINT16(1, SFIFO_PeekRead(myFifo, spans));
+  TEST_ASSERT_EQUAL_PTR(&myFifo->buffer[1 * ITEM_SIZE], spans[0].pData);
+  TEST_ASSERT_EQUAL_UINT16(1, spans[0].nItems);
+  TEST_ASSERT_EQUAL_UINT16(0, spans[1].nItems);
+  TEST_ASSERT_EQUAL_MEMORY(&items[7], spans[0].pData, ITEM_SIZE);
+
+  TEST_ASSERT_TRUE(SFIFO_Consume(myFifo, 1));
+  TEST_ASSERT_TRUE(SFIFO_IsEmpty(myFifo));
+  TEST_ASSERT_EQUAL_UINT16(0, myFifo->head);
+  TEST_ASSERT_EQUAL_UINT16(0, myFifo->tail);
+}
+
 /**
  * @} end of group TC_S-FIFO Static FIFO Queue unit tests
  */
@@ -0,0 +1,162 @@
+/*=======================================================================================*
+ * @file    TC_SPSC-FIFO.c
+ * @author  Damian Pala
+ * @date    18-10-2026
+ * @brief   This file contains unit tests for SPSC-FIFO module.
+ *======================================================================================*/
+
+/**
+ * @addtogroup TC_SPSC-FIFO Lock-free SPSC FIFO Queue unit tests
+ * @{
+ * @brief Unit tests implementation.
+ */
+
+/*======================================================================================*/
+/*                       ####### PREPROCESSOR DIRECTIVES #######                        */
+/*======================================================================================*/
+/*---------------------- INCLUDE DIRECTIVES FOR STANDARD HEADERS -----------------------*/
+#include <pthread.h>
+#include <sched.h>
+
+/*----------------------- INCLUDE DIRECTIVES FOR OTHER HEADERS -------------------------*/
+#include "unity.h"
+#include "unity_fixture.h"
+
+#include "SPSC-FIFO.c"
+
+/*----------------------------- LOCAL OBJECT-LIKE MACROS -------------------------------*/
+#define TEST_TRANSFERRED_ITEMS        1000000
+
+/*---------------------------- LOCAL FUNCTION-LIKE MACROS ------------------------------*/
+
+/*======================================================================================*/
+/*                      ####### LOCAL TYPE DECLARATIONS #######                         */
+/*======================================================================================*/
+/*-------------------------------- OTHER TYPEDEFS --------------------------------------*/
+
+/*------------------------------------- ENUMS ------------------------------------------*/
+
+/*------------------------------- STRUCT AND UNIONS ------------------------------------*/
+
+/*======================================================================================*/
+/*                         ####### OBJECT DEFINITIONS #######                           */
+/*======================================================================================*/
+/*--------------------------------- EXPORTED OBJECTS -----------------------------------*/
+
+/*---------------------------------- LOCAL OBJECTS -------------------------------------*/
+/**
+ * @brief   SPSCFIFO Test Group.
+ */
+TEST_GROUP(SPSCFIFO);
+
+SPSCFIFO_Create(SharedFifo, sizeof(uint32_t), 61);
+
+/*======================================================================================*/
+/*                    ####### LOCAL FUNCTIONS PROTOTYPES #######                        */
+/*======================================================================================*/
+static void* ProduceItems(void *arg);
+
+/*======================================================================================*/
+/*                   ####### LOCAL FUNCTIONS DEFINITIONS #######                        */
+/*======================================================================================*/
+static void* ProduceItems(void *arg)
+{
+  for (uint32_t item = 0; item < TEST_TRANSFERRED_ITEMS; item++)
+  {
+    while (false == SPSCFIFO_PushItem(SharedFifo, &item))
+    {
+      sched_yield();
+    }
+  }
+
+  return arg;
+}
+
+/*======================================================================================*/
+/*                        ####### TESTS DEFINITIONS #######                             */
+/*======================================================================================*/
+/**
+ * @brief   Setup Test Environment.
+ */
+TEST_SETUP(SPSCFIFO)
+{
+
+}
+
+/**
+ * @brief   Tear Down Test Environment.
+ */
+TEST_TEAR_DOWN(SPSCFIFO)
+{
+
+}
+
+TEST(SPSCFIFO, SPSCFIFO_should_PushAndPopAndCountItemsProperlyAfterManyWraparounds)
+{
+  enum {ITEM_NUMBER = 5};
+  uint32_t pushedItem = 0;
+  uint32_t poppedItem = 0;
+
+  SPSCFIFO_Create(myFifo, sizeof(uint32_t), ITEM_NUMBER);
+
+  for (uint16_t round = 0; round < 4 * ITEM_NUMBER + 1; round++)
+  {
+    uint16_t nItems = (uint16_t)(round % (ITEM_NUMBER + 1));
+
+    TEST_ASSERT_TRUE(SPSCFIFO_IsEmpty(myFifo));
+    TEST_ASSERT_FALSE(SPSCFIFO_PopItem(myFifo, &poppedItem));
+
+    for (uint16_t item = 0; item < nItems; item++)
+    {
+      pushedItem++;
+      TEST_ASSERT_TRUE(SPSCFIFO_PushItem(myFifo, &pushedItem));
+      TEST_ASSERT_EQUAL_UINT16(item + 1, SPSCFIFO_GetItemsInFifo(myFifo));
+    }
+
+    if (ITEM_NUMBER == nItems)
+    {
+      TEST_ASSERT_TRUE(SPSCFIFO_IsFull(myFifo));
+      TEST_ASSERT_FALSE(SPSCFIFO_PushItem(myFifo, &pushedItem));
+    }
+    else
+    {
+      TEST_ASSERT_FALSE(SPSCFIFO_IsFull(myFifo));
+    }
+
+    for (uint16_t item = nItems; item > 0; item--)
+    {
+      TEST_ASSERT_TRUE(SPSCFIFO_PopItem(myFifo, &poppedItem));
+      TEST_ASSERT_EQUAL_HEX32(pushedItem - item + 1, poppedItem);
+    }
+  }
+}
+
+TEST(SPSCFIFO, SPSCFIFO_should_TransferItemsInOrderBetweenThreads)
+{
+  pthread_t producer;
+  uint32_t poppedItem;
+
+  TEST_ASSERT_EQUAL(0, pthread_create(&producer, NULL, ProduceItems, NULL));
+
+  for (uint32_t item = 0; item < TEST_TRANSFERRED_ITEMS; item++)
+  {
+    while (false == SPSCFIFO_PopItem(SharedFifo, &poppedItem))
+    {
+      sched_yield();
+    }
+
+    if (item != poppedItem)
+    {
+      pthread_join(producer, NULL);
+      TEST_ASSERT_EQUAL_UINT32(item, poppedItem);
+    }
+  }
+
+  pthread_join(producer, NULL);
+
+  TEST_ASSERT_TRUE(SPSCFIFO_IsEmpty(SharedFifo));
+}
+
+/**
+ * @} end of group TC_SPSC-FIFO
+ */
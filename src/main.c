@@ -23,6 +23,9 @@
 /*======================================================================================*/
 TEST_GROUP_RUNNER(FIFO)
 {
+  /* It has to be the first test calculating CRC, see the test description */
+  RUN_TEST_CASE(CRCMT, CRCMT_Calc_should_BeSafeAsTheFirstCrcCalculationOfProcess);
+
   RUN_TEST_CASE(FIFO, FIFO_should_PushAndPopAndCountItemsProperlyAndReturnFalseWhenFullOrEmpty);
   RUN_TEST_CASE(FIFO, FIFO_should_OverwriteLastItemsWhenPushedMoreItemsThanFifoSize);
   RUN_TEST_CASE(FIFO, FIFO_should_OverwriteLastItemsWhenPushedMoreItemsThanFifoSizeIterationTest);
@@ -38,10 +41,56 @@ TEST_GROUP_RUNNER(FIFO)
   RUN_TEST_CASE(FIFO, SFIFO_UpdateLastItem_should_UpdateLastItemProperlyWhenFifoIsOverflowed);
   RUN_TEST_CASE(FIFO, SFIFO_UpdateLastItem_should_UpdateLastItemProperlyWhenFifoIsOverwriten);
   RUN_TEST_CASE(FIFO, SFIFO_UpdateLastItem_should_UpdateLastItemProperlyInVariousSimpleCases);
+  RUN_TEST_CASE(FIFO, SFIFO_PushItems_should_PushOnlyItemsWhichFitWhenNotOverwriting);
+  RUN_TEST_CASE(FIFO, SFIFO_PushItemsAndPopItems_should_WorkAsSinglePushesAndPops);
+  RUN_TEST_CASE(FIFO, SFIFO_ReserveWrite_should_ReturnFreePlacesWhichAreCommittedInOrder);
+  RUN_TEST_CASE(FIFO, SFIFO_PeekRead_should_ReturnItemsInPlaceUntilTheyAreConsumed);
+
+  RUN_TEST_CASE(SPSCFIFO, SPSCFIFO_should_PushAndPopAndCountItemsProperlyAfterManyWraparounds);
+  RUN_TEST_CASE(SPSCFIFO, SPSCFIFO_should_TransferItemsInOrderBetweenThreads);
+
+  RUN_TEST_CASE(MPMCFIFO, MPMCFIFO_should_PushAndPopAndCountItemsProperlyAfterManyWraparounds);
+  RUN_TEST_CASE(MPMCFIFO, MPMCFIFO_should_TransferAllItemsBetweenManyThreads);
 
   RUN_TEST_CASE(CRC, CRC8_should_BeCalculatedProperly);
   RUN_TEST_CASE(CRC, CRC16_should_BeCalculatedProperly);
   RUN_TEST_CASE(CRC, CRC32_should_BeCalculatedProperly);
+  RUN_TEST_CASE(CRC, CRC_Tables_should_MatchBitwiseAlgorithm);
+  RUN_TEST_CASE(CRC, CRC_should_MatchBitwiseAlgorithmOnLongBuffers);
+  RUN_TEST_CASE(CRC, CRC32_should_BeCalculatedProperlyForEveryLengthAndAlignment);
+  RUN_TEST_CASE(CRC, CRC16_should_BeCalculatedProperlyForEveryLengthAndAlignment);
+  RUN_TEST_CASE(CRC, CRC32C_should_MatchStandardCheckValues);
+  RUN_TEST_CASE(CRC, CRC32C_should_BeCalculatedProperlyOnLongBuffers);
+  RUN_TEST_CASE(CRC, CRC_Ctx_should_CalculateInterleavedStreamsProperly);
+  RUN_TEST_CASE(CRC, CRC_Combine_should_GiveCrcOfConcatenatedData);
+  RUN_TEST_CASE(CRC, CRC_should_BeCalculatedProperlyForBuffersLongerThan64KiB);
+  RUN_TEST_CASE(CRC, CRC_CalcBatch_should_GiveTheSameCrcsAsSingleBufferCalculation);
+  RUN_TEST_CASE(CRC, CRC_CopyAndCalc_should_CopyDataAndGiveTheSameCrc);
+  RUN_TEST_CASE(CRC, CRC_CalcSegments_should_GiveCrcOfConcatenatedSegments);
+  RUN_TEST_CASE(CRC, CRC_Patch_should_GiveCrcOfModifiedData);
+  RUN_TEST_CASE(CRC, CRC_Patch_should_ReturnUnchangedCrcWhenChangedBytesExceedData);
+
+  RUN_TEST_CASE(CRCMT, CRCMT_Calc_should_GiveTheSameCrcAsSingleThread);
+  RUN_TEST_CASE(CRCMT, CRCMT_Calc_should_CalculateSmallBuffersProperly);
+  RUN_TEST_CASE(CRCMT, CRCMT_Pool_should_CompleteAllSubmittedJobs);
+  RUN_TEST_CASE(CRCMT, CRCMT_PoolDeinit_should_CompleteQueuedJobs);
+
+  RUN_TEST_CASE(CRCM, CRCM_Catalog_should_MatchCheckValues);
+  RUN_TEST_CASE(CRCM, CRCM_Update_should_GiveTheSameCrcAsCalc);
+  RUN_TEST_CASE(CRCM, CRCM_FindModel_should_FindModelsByName);
+  RUN_TEST_CASE(CRCM, CRCM_Init_should_RejectNotSupportedWidth);
+
+  RUN_TEST_CASE(CSUM, CSUM_should_MatchKnownValues);
+  RUN_TEST_CASE(CSUM, CSUM_should_MatchReferenceForEveryLengthAndAlignment);
+  RUN_TEST_CASE(CSUM, CSUM_should_NotOverflowOnLongBuffersOfMaximalBytes);
+  RUN_TEST_CASE(CSUM, CSUM_UpdateAdler32_should_GiveTheSameChecksumAsCalc);
+
+  RUN_TEST_CASE(HASH, HASH_should_MatchReferenceImplementation);
+  RUN_TEST_CASE(HASH, HASH_Ctx_should_GiveTheSameHashAsCalcForAnySplit);
+  RUN_TEST_CASE(HASH, HASH_should_NotDependOnDataAlignment);
+
+  RUN_TEST_CASE(CPUF, CPUF_GetFeatures_should_ReportConsistentFeatures);
+  RUN_TEST_CASE(CPUF, CPUF_IsSupported_should_RequireAllGivenFeatures);
 
   RUN_TEST_CASE(SEEPM, SEEPM_should_InitMemoryProperly);
   RUN_TEST_CASE(SEEPM, SEEPM_should_InitMemoryProperlyAfterReset);
@@ -0,0 +1,286 @@
+/*=======================================================================================*
+ * @file    CRC_Sum.c
+ * @author  Damian Pala
+ * @date    18-10-2026
+ * @brief   This file contains command line tool calculating CRC of files.
+ *
+ *          CRC of every given file is written to stdout, one line per file, in the same
+ *          format as by md5sum. Without files, or for file named "-", stdin is read:
+ *
+ *            crcsum [--width 8|16|32|32C] [--threads n] [file ...]
+ *
+ *          Regular files are mapped into memory and calculated by CRCMT module, so big files
+ *          use many threads. Pipes and files which cannot be mapped are read in large blocks.
+ *          Tool is built with POSIX threads:
+ *
+ *            gcc -std=c11 -O2 -o crcsum tools/CRC_Sum.c src/CRC.c src/CRCMT.c src/CPUF.c -lpthread
+ *======================================================================================*/
+
+/**
+ * @addtogroup CRC_Sum CRC of files calculation tool
+ * @{
+ * @brief Tool implementation.
+ */
+
+/*======================================================================================*/
+/*                       ####### PREPROCESSOR DIRECTIVES #######                        */
+/*======================================================================================*/
+/*---------------------- INCLUDE DIRECTIVES FOR STANDARD HEADERS -----------------------*/
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+/*----------------------- INCLUDE DIRECTIVES FOR OTHER HEADERS -------------------------*/
+#include "../src/CRC.h"
+#include "../src/CRCMT.h"
+
+/*----------------------------- LOCAL OBJECT-LIKE MACROS -------------------------------*/
+#define SUM_READ_BLOCK_SIZE           (1024 * 1024)     ///< Size of single read from pipe, multiple of page size
+#define SUM_READ_BLOCK_ALIGNMENT      4096
+
+/*---------------------------- LOCAL FUNCTION-LIKE MACROS ------------------------------*/
+#define ARRAY_SIZE(array)             (sizeof(array) / sizeof((array)[0]))
+
+/*======================================================================================*/
+/*                      ####### LOCAL TYPE DECLARATIONS #######                         */
+/*======================================================================================*/
+/*-------------------------------- OTHER TYPEDEFS --------------------------------------*/
+
+/*------------------------------------- ENUMS ------------------------------------------*/
+
+/*------------------------------- STRUCT AND UNIONS ------------------------------------*/
+typedef struct Width_Tag
+{
+  char const *name;             ///< CRC width name given in command line
+  CRC_CalcSize_T crcSize;       ///< Size of calculated CRC
+  int nDigits;                  ///< Number of hexadecimal digits of printed CRC
+} Width_T;
+
+/*======================================================================================*/
+/*                         ####### OBJECT DEFINITIONS #######                           */
+/*======================================================================================*/
+/*--------------------------------- EXPORTED OBJECTS -----------------------------------*/
+
+/*---------------------------------- LOCAL OBJECTS -------------------------------------*/
+static const Width_T Widths[] =
+{
+  {"8",   CRC_CALC_SIZE_8,   2},
+  {"16",  CRC_CALC_SIZE_16,  4},
+  {"32",  CRC_CALC_SIZE_32,  8},
+  {"32C", CRC_CALC_SIZE_32C, 8},
+};
+
+static uint8_t *ReadBuffer;
+
+/*======================================================================================*/
+/*                    ####### LOCAL FUNCTIONS PROTOTYPES #######                        */
+/*======================================================================================*/
+static bool CalcFileCrc(char const *path, CRC_CalcSize_T crcSize, uint8_t nThreads, uint32_t *crc);
+static bool CalcMappedCrc(int fd, size_t nBytes, CRC_CalcSize_T crcSize, uint8_t nThreads, uint32_t *crc);
+static bool CalcStreamCrc(int fd, CRC_CalcSize_T crcSize, uint32_t *crc);
+
+/*======================================================================================*/
+/*                  ####### EXPORTED FUNCTIONS DEFINITIONS #######                      */
+/*======================================================================================*/
+int main(int argc, char *argv[])
+{
+  static char const * const stdinPath[] = {"-"};
+  Width_T const *width = &Widths[2];
+  long nCpus = sysconf(_SC_NPROCESSORS_ONLN);
+  uint8_t nThreads = (nCpus > CRCMT_MAX_THREADS) ? CRCMT_MAX_THREADS : ((nCpus > 0) ? (uint8_t)nCpus : 1);
+  char const * const *paths;
+  int nPaths;
+  int arg;
+  int result = EXIT_SUCCESS;
+
+  for (arg = 1; (arg < argc) && ('-' == argv[arg][0]) && ('\0' != argv[arg][1]); arg++)
+  {
+    bool isValid = false;
+
+    if ( (0 == strcmp(argv[arg], "--width")) && (arg + 1 < argc) )
+    {
+      arg++;
+
+      for (size_t idx = 0; idx < ARRAY_SIZE(Widths); idx++)
+      {
+        if (0 == strcmp(argv[arg], Widths[idx].name))
+        {
+          width = &Widths[idx];
+          isValid = true;
+        }
+      }
+    }
+    else if ( (0 == strcmp(argv[arg], "--threads")) && (arg + 1 < argc) )
+    {
+      unsigned long threads = strtoul(argv[++arg], NULL, 0);
+
+      nThreads = (threads > CRCMT_MAX_THREADS) ? CRCMT_MAX_THREADS : (uint8_t)threads;
+      isValid = (0 != nThreads);
+    }
+    else if (0 == strcmp(argv[arg], "--"))
+    {
+      arg++;
+      break;
+    }
+
+    if (false == isValid)
+    {
+      fprintf(stderr, "Usage: %s [--width 8|16|32|32C] [--threads n] [file ...]\n", argv[0]);
+      return EXIT_FAILURE;
+    }
+  }
+
+  ReadBuffer = aligned_alloc(SUM_READ_BLOCK_ALIGNMENT, SUM_READ_BLOCK_SIZE);
+  if (NULL == ReadBuffer)
+  {
+    fprintf(stderr, "Cannot allocate %d bytes\n", SUM_READ_BLOCK_SIZE);
+    return EXIT_FAILURE;
+  }
+
+  paths = (arg < argc) ? (char const * const *)&argv[arg] : stdinPath;
+  nPaths = (arg < argc) ? (argc - arg) : 1;
+
+  for (int pathIdx = 0; pathIdx < nPaths; pathIdx++)
+  {
+    uint32_t crc;
+
+    if (true == CalcFileCrc(paths[pathIdx], width->crcSize, nThreads, &crc))
+    {
+      printf("%0*X  %s\n", width->nDigits, (unsigned int)crc, paths[pathIdx]);
+    }
+    else
+    {
+      fprintf(stderr, "%s: %s\n", paths[pathIdx], strerror(errno));
+      result = EXIT_FAILURE;
+    }
+  }
+
+  free(ReadBuffer);
+
+  return result;
+}
+
+/*======================================================================================*/
+/*                   ####### LOCAL FUNCTIONS DEFINITIONS #######                        */
+/*======================================================================================*/
+/**
+ * @brief   Calculates CRC of file, regular files are mapped, other ones are read.
+ * @param   [in] path       is file path, "-" means stdin
+ * @param   [in] crcSize    is size of calculated CRC
+ * @param   [in] nThreads   is maximal number of threads
+ * @param   [out] crc       is calculated CRC
+ * @return  true if CRC is calculated, false if file cannot be read, errno describes the error.
+ */
+static bool CalcFileCrc(char const *path, CRC_CalcSize_T crcSize, uint8_t nThreads, uint32_t *crc)
+{
+  bool isStdin = (0 == strcmp(path, "-"));
+  int fd = (true == isStdin) ? STDIN_FILENO : open(path, O_RDONLY);
+  struct stat fileStat;
+  bool isCalculated = false;
+  int error;
+
+  if (fd < 0)
+  {
+    return false;
+  }
+
+  if ( (0 == fstat(fd, &fileStat)) && (S_ISREG(fileStat.st_mode)) && (fileStat.st_size > 0) &&
+       ((uintmax_t)fileStat.st_size <= SIZE_MAX) && (0 == lseek(fd, 0, SEEK_CUR)) )
+  {
+    isCalculated = CalcMappedCrc(fd, (size_t)fileStat.st_size, crcSize, nThreads, crc);
+  }
+
+  if (false == isCalculated)
+  {
+    isCalculated = CalcStreamCrc(fd, crcSize, crc);
+  }
+
+  error = errno;
+  if (false == isStdin)
+  {
+    close(fd);
+  }
+  errno = error;
+
+  return isCalculated;
+}
+
+/**
+ * @brief   Calculates CRC of mapped regular file, big files are calculated by many threads.
+ * @return  false if file cannot be mapped, it is read then.
+ */
+static bool CalcMappedCrc(int fd, size_t nBytes, CRC_CalcSize_T crcSize, uint8_t nThreads, uint32_t *crc)
+{
+  void *data = mmap(NULL, nBytes, PROT_READ, MAP_PRIVATE, fd, 0);
+
+  if (MAP_FAILED == data)
+  {
+    return false;
+  }
+
+  /* Kernel reads ahead aggressively and drops pages behind, each thread reads its chunk sequentially */
+  (void)posix_madvise(data, nBytes, POSIX_MADV_SEQUENTIAL);
+
+  *crc = CRCMT_Calc(crcSize, data, nBytes, nThreads);
+
+  munmap(data, nBytes);
+
+  return true;
+}
+
+/**
+ * @brief   Calculates CRC of data read from file descriptor in blocks of #SUM_READ_BLOCK_SIZE.
+ * @return  false on read error.
+ */
+static bool CalcStreamCrc(int fd, CRC_CalcSize_T crcSize, uint32_t *crc)
+{
+  CRC_Ctx_T ctx;
+  bool isEnd = false;
+
+  CRC_CtxInit(&ctx, crcSize);
+  (void)posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+
+  while (false == isEnd)
+  {
+    size_t nBytes = 0;
+
+    /* Pipe returns at most its capacity at once, block is filled up to keep CRC kernels on long data */
+    while (nBytes < SUM_READ_BLOCK_SIZE)
+    {
+      ssize_t nRead = read(fd, &ReadBuffer[nBytes], SUM_READ_BLOCK_SIZE - nBytes);
+
+      if (nRead > 0)
+      {
+        nBytes += (size_t)nRead;
+      }
+      else if (0 == nRead)
+      {
+        isEnd = true;
+        break;
+      }
+      else if (EINTR != errno)
+      {
+        return false;
+      }
+    }
+
+    CRC_CtxUpdate(&ctx, ReadBuffer, nBytes);
+  }
+
+  *crc = CRC_CtxFinal(&ctx);
+
+  return true;
+}
+
+/**
+ * @}
+ */